@@ -4,7 +4,7 @@
 * \verbatim
 ******************************************************************************
 *                                                                            *
-*    Copyright (c) 2015-2022, b-plus technologies GmbH.                      *
+*    Copyright (c) 2015-2026, b-plus technologies GmbH.                      *
 *                                                                            *
 *    All rights are reserved by b-plus technologies GmbH.                    *
 *    The Customer is entitled to modify this software under his              *
@@ -19,9 +19,9 @@
 *
 * \brief Data Forwarding MO
 * \author Christopher Maneth
-* \copyright (C)2015-2022 b-plus technologies GmbH
-* \date 04.05.2022
-* \version 2.4
+* \copyright (C)2015-2026 b-plus technologies GmbH
+* \date 19.10.2026
+* \version 2.5
 *
 ******************************************************************************/
 
@@ -36,7 +36,13 @@ CProcessorObject::CProcessorObject() :
 	m_ZeroMQRecvThread(),
 	m_ZmqRecvSock(m_ZmqCtx, zmq::socket_type::pull),
 	m_bZeroMQActive(false),
-	m_iZmqChannel(0)
+	m_iZmqChannel(0),
+	m_bChunkActive(false),
+	m_uiChunkTimestamp(0),
+	m_uiChunkTotalSize(0),
+	m_uiChunkSize(0),
+	m_uiChunksReceived(0),
+	m_uiIncompleteFrames(0)
 {
 }
 
@@ -130,7 +136,7 @@ int CProcessorObject::ZeroMQRecvLoop()
 			msgpack::object typeObj = typeUnpacked.get();
 			auto type = typeObj.as<std::string>();
 
-			if (type != "image")
+			if (type != "image" && type != "image" ZEROMQ_CHUNK_SUFFIX)
 			{
 				continue;
 			}
@@ -161,7 +167,11 @@ int CProcessorObject::ZeroMQRecvLoop()
 			msgpack::object metaObj = metaUnpacked.get();
 			auto meta = metaObj.as<std::string>();
 
-
+			if (type != "image")
+			{
+				HandleChunk(msg, totalOffset, timestamp, formatSize, meta);
+				continue;
+			}
 
 			AvCore::SDataPacketPtr ptrPacketJson;
 			if (!m_connOutMeta.AllocatePacket(ptrPacketJson, meta.size()))
@@ -194,13 +204,7 @@ int CProcessorObject::ZeroMQRecvLoop()
 				continue;
 			}
 
-			if (m_uiOutputWidth != formatSize[0] || m_uiOutputHeight != formatSize[1])
-			{
-				m_uiOutputWidth = formatSize[0];
-				m_uiOutputHeight = formatSize[1];
-
-				m_connOutImg.SetImageSize(m_uiOutputWidth, m_uiOutputHeight);
-			}
+			SetImageSize(formatSize[0], formatSize[1]);
 
 
 			AvCore::SDataPacketPtr ptrPacket;
@@ -223,3 +227,151 @@ int CProcessorObject::ZeroMQRecvLoop()
 
 	return 0;
 }
+
+void CProcessorObject::HandleChunk(const zmq::message_t& msg, std::size_t totalOffset, uint64_t timestamp,
+	const std::array<int, 3>& formatSize, const std::string& meta)
+{
+	// chunk description: offset, total size, chunk index, chunk count
+	msgpack::unpacked chunkUnpacked;
+	std::size_t chunkOffset = 0;
+	msgpack::unpack(chunkUnpacked, static_cast<const char*>(msg.data()) + totalOffset, msg.size() - totalOffset, chunkOffset);
+	totalOffset += chunkOffset;
+	auto chunk = chunkUnpacked.get().as<std::array<uint64_t, 4>>();
+
+	// reference the chunk data inside the message instead of copying it
+	msgpack::unpacked dataUnpacked;
+	std::size_t dataOffset = 0;
+	bool referenced = false;
+	msgpack::unpack(dataUnpacked, static_cast<const char*>(msg.data()) + totalOffset, msg.size() - totalOffset, dataOffset, referenced,
+		[](msgpack::type::object_type, std::size_t, void*) { return true; });
+	msgpack::object dataObj = dataUnpacked.get();
+
+	if (dataObj.type != msgpack::type::BIN)
+	{
+		return;
+	}
+
+	const uint64_t imgSize = (uint64_t)formatSize[0] * (uint64_t)formatSize[1] * (uint64_t)(formatSize[2] / 8);
+	uint64_t chunkSize = 0;
+	if (chunk[1] != imgSize || !CheckChunk(chunk, dataObj.via.bin.size, chunkSize))
+	{
+		return;
+	}
+
+	// a chunk of a new frame drops the frame which is still incomplete; several clients may answer the same
+	// frame (their chunks interleave), so a different size or chunk count also starts a new frame
+	if (!m_bChunkActive || m_uiChunkTimestamp != timestamp || m_uiChunkTotalSize != chunk[1] || m_vecChunkReceived.size() != chunk[3] ||
+		m_uiChunkSize != chunkSize)
+	{
+		if (m_bChunkActive)
+		{
+			m_uiIncompleteFrames++;
+		}
+
+		SetImageSize(formatSize[0], formatSize[1]);
+
+		m_ptrChunkPacket = AvCore::SDataPacketPtr();
+		m_bChunkActive = m_connOutImg.AllocatePacket(m_ptrChunkPacket, imgSize);
+		m_uiChunkTimestamp = timestamp;
+		m_uiChunkTotalSize = chunk[1];
+		m_uiChunkSize = chunkSize;
+		m_vecChunkReceived.assign(static_cast<size_t>(chunk[3]), false);
+		m_uiChunksReceived = 0;
+		m_ssChunkMeta.clear();
+
+		if (!m_bChunkActive)
+		{
+			m_vecChunkReceived.clear();
+			return;
+		}
+	}
+
+	if (m_vecChunkReceived[chunk[2]])
+	{
+		return;  // duplicate
+	}
+
+	memcpy(reinterpret_cast<char*>(m_ptrChunkPacket.pDataBuffer) + chunk[0], dataObj.via.bin.ptr, dataObj.via.bin.size);
+	m_vecChunkReceived[chunk[2]] = true;
+	m_uiChunksReceived++;
+
+	if (!meta.empty())
+	{
+		m_ssChunkMeta = meta;
+	}
+
+	if (m_uiChunksReceived < chunk[3])
+	{
+		return;
+	}
+
+	AvCore::SDataPacketPtr ptrPacketJson;
+	if (m_connOutMeta.AllocatePacket(ptrPacketJson, m_ssChunkMeta.size()))
+	{
+		memcpy(ptrPacketJson.pDataBuffer, m_ssChunkMeta.data(), m_ssChunkMeta.size());
+		m_connOutMeta.SetData(ptrPacketJson);
+	}
+
+	m_connOutImg.SetData(m_ptrChunkPacket);
+	m_ptrChunkPacket = AvCore::SDataPacketPtr();
+	m_bChunkActive = false;
+	m_vecChunkReceived.clear();
+}
+
+bool CProcessorObject::CheckChunk(const std::array<uint64_t, 4>& chunk, uint64_t size, uint64_t& chunkSize)
+{
+	// chunk description: offset, total size, chunk index, chunk count
+	const uint64_t offset = chunk[0];
+	const uint64_t totalSize = chunk[1];
+	const uint64_t index = chunk[2];
+	const uint64_t count = chunk[3];
+
+	if (count == 0 || index >= count || count > std::max<uint64_t>(totalSize, 1) || size > totalSize || offset > totalSize - size)
+	{
+		return false;
+	}
+
+	if (count == 1)
+	{
+		chunkSize = totalSize;
+		return offset == 0 && size == totalSize;
+	}
+
+	// every chunk but the last one has the full size and starts at index * chunk size, so the distinct
+	// indices of a frame cover the image without gaps
+	if (index + 1 < count)
+	{
+		if (size == 0 || offset % size != 0 || offset / size != index)
+		{
+			return false;
+		}
+
+		chunkSize = size;
+	}
+	else
+	{
+		if (offset + size != totalSize || offset % index != 0)
+		{
+			return false;
+		}
+
+		chunkSize = offset / index;
+		if (size == 0 || size > chunkSize)
+		{
+			return false;
+		}
+	}
+
+	return (totalSize - 1) / chunkSize + 1 == count;
+}
+
+void CProcessorObject::SetImageSize(uint32_t uiWidth, uint32_t uiHeight)
+{
+	if (m_uiOutputWidth != uiWidth || m_uiOutputHeight != uiHeight)
+	{
+		m_uiOutputWidth = uiWidth;
+		m_uiOutputHeight = uiHeight;
+
+		m_connOutImg.SetImageSize(m_uiOutputWidth, m_uiOutputHeight);
+	}
+}
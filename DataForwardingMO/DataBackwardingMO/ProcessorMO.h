@@ -4,7 +4,7 @@
 * \verbatim
 ******************************************************************************
 *                                                                            *
-*    Copyright (c) 2015-2022, b-plus technologies GmbH.                      *
+*    Copyright (c) 2015-2026, b-plus technologies GmbH.                      *
 *                                                                            *
 *    All rights are reserved by b-plus technologies GmbH.                    *
 *    The Customer is entitled to modify this software under his              *
@@ -19,9 +19,9 @@
 *
 * \brief Data Forwarding MO
 * \author Christopher Maneth
-* \copyright (C)2015-2022 b-plus technologies GmbH
-* \date 04.05.2022
-* \version 2.4
+* \copyright (C)2015-2026 b-plus technologies GmbH
+* \date 19.10.2026
+* \version 2.5
 *
 ******************************************************************************/
 
@@ -38,14 +38,15 @@
 #define VERSIONINFO_COMMENTS            ""
 
 // Version information
-#define VERSIONINFO_VERSION             2.4
-#define VERSIONINFO_BUILD               240
+#define VERSIONINFO_VERSION             2.5
+#define VERSIONINFO_BUILD               250
 #define VERSIONINFO_SUBBUILD            0
 
 // ZMQ configuration
 #define ZEROMQ_LISTEN					"tcp://0.0.0.0:"
 #define ZEROMQ_START_PORT				(5870)
 #define ZEROMQ_CHANNEL_LIMIT			(20)
+#define ZEROMQ_CHUNK_SUFFIX				"_chunk"
 
 #if defined(_MSC_VER)
 #	define NOMINMAX
@@ -59,6 +60,8 @@
 #include <chrono>
 #include <thread>
 #include <queue>
+#include <vector>
+#include <algorithm>
 #include <msgpack.hpp>
 #include <zmq.hpp>
 #include <zmq_addon.hpp>
@@ -111,6 +114,7 @@ public:
 		AVETO_PROPERTY_SET_READONLY_FLAG()
 		AVETO_PROPERTY_ENTRY(m_iZmqChannel, "Backward Channel", "The channel used for backwarding")
 		AVETO_PROPERTY_ENTRY(m_iZmqPort, "Backward Port", "The tcp port used for backwarding")
+		AVETO_PROPERTY_ENTRY(m_uiIncompleteFrames, "Incomplete Frames", "Chunked frames dropped because of missing chunks")
 		AVETO_PROPERTY_RESET_READONLY_FLAG()
 	END_AVETO_PROPERTY_MAP()
 
@@ -151,8 +155,30 @@ private:
 	int															m_iZmqChannel;
 	int															m_iZmqPort;
 
+	// Chunked results
+	AvCore::SDataPacketPtr										m_ptrChunkPacket;				//!< Image packet the chunks are reassembled into
+	bool														m_bChunkActive;					//!< m_ptrChunkPacket holds an incomplete frame
+	uint64_t													m_uiChunkTimestamp;				//!< Timestamp of the frame being reassembled
+	uint64_t													m_uiChunkTotalSize;				//!< Size of m_ptrChunkPacket
+	uint64_t													m_uiChunkSize;					//!< Size of all but the last chunk of the frame
+	std::vector<bool>											m_vecChunkReceived;				//!< Received chunks of the frame, per index
+	uint64_t													m_uiChunksReceived;
+	std::string													m_ssChunkMeta;
+	uint32_t													m_uiIncompleteFrames;
+
 
 	int ZeroMQRecvLoop();
+
+	void HandleChunk(const zmq::message_t& msg, std::size_t totalOffset, uint64_t timestamp,
+		const std::array<int, 3>& formatSize, const std::string& meta);
+
+	/**
+	 * \brief Checks that a chunk is consistent with its description (offset == index * chunk size, only the
+	 *		last chunk may be shorter) and returns the chunk size of its frame.
+	 */
+	static bool CheckChunk(const std::array<uint64_t, 4>& chunk, uint64_t size, uint64_t& chunkSize);
+
+	void SetImageSize(uint32_t uiWidth, uint32_t uiHeight);
 };
 
 DEFINE_AVETO_OBJECT(CProcessorObject)
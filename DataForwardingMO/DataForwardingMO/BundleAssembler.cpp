@@ -0,0 +1,167 @@
+/******************************************************************************/
+/*! \file
+*
+* \verbatim
+******************************************************************************
+*                                                                            *
+*    Copyright (c) 2015-2026, b-plus technologies GmbH.                      *
+*                                                                            *
+*    All rights are reserved by b-plus technologies GmbH.                    *
+*    The Customer is entitled to modify this software under his              *
+*    own license terms.                                                      *
+*                                                                            *
+*    You may use this code according to the license terms of b-plus.         *
+*    Please contact b-plus at services@b-plus.com to get the actual          *
+*    terms and conditions.                                                   *
+*                                                                            *
+******************************************************************************
+\endverbatim
+*
+* \brief Data Forwarding MO - timestamp bundles of several inputs
+* \author Christopher Maneth
+* \copyright (C)2015-2026 b-plus technologies GmbH
+* \date 19.10.2026
+* \version 2.5
+*
+******************************************************************************/
+
+
+#include "BundleAssembler.h"
+
+CBundleAssembler::CBundleAssembler(size_t uiInputs, size_t uiMaxOpen) :
+	m_uiInputs(uiInputs),
+	m_uiMaxOpen(uiMaxOpen),
+	m_vecLastTimestamp(uiInputs, 0)
+{
+}
+
+void CBundleAssembler::Add(size_t uiInput, uint64_t uiTimestamp, const std::shared_ptr<AvCore::SDataPacketPtr>& rptrPacket,
+	std::vector<SBundle>& rvecComplete)
+{
+	if (uiInput >= m_uiInputs)
+		return;
+
+	const uint32_t uiInputBit = 1u << uiInput;
+	if (!(m_uiExpectedMask & uiInputBit))
+		return;
+
+	// a jump back in time means the source restarted (e.g. a replay), old bundles can not be completed any more
+	if ((m_uiSeenMask & uiInputBit) && uiTimestamp < m_vecLastTimestamp[uiInput])
+	{
+		m_uiDropped += m_dequeOpen.size();
+		Reset();
+	}
+
+	m_vecLastTimestamp[uiInput] = uiTimestamp;
+	m_uiSeenMask |= uiInputBit;
+
+	// join the bundle with the closest timestamp within the tolerance which still misses this input
+	// (the older one on a tie)
+	auto itBundle = m_dequeOpen.end();
+	uint64_t uiBestDiff = 0;
+	for (auto it = m_dequeOpen.begin(); it != m_dequeOpen.end(); ++it)
+	{
+		const uint64_t uiDiff = uiTimestamp > it->uiTimestamp ?
+			uiTimestamp - it->uiTimestamp : it->uiTimestamp - uiTimestamp;
+
+		if ((it->uiInputMask & uiInputBit) || uiDiff > m_uiTolerance)
+			continue;
+
+		if (itBundle == m_dequeOpen.end() || uiDiff < uiBestDiff)
+		{
+			itBundle = it;
+			uiBestDiff = uiDiff;
+		}
+	}
+
+	if (itBundle == m_dequeOpen.end())
+	{
+		SBundle sBundle;
+		sBundle.uiTimestamp = uiTimestamp;
+		sBundle.vecPackets.resize(m_uiInputs);
+
+		// keep the bundles sorted by timestamp
+		itBundle = m_dequeOpen.begin();
+		while (itBundle != m_dequeOpen.end() && itBundle->uiTimestamp <= uiTimestamp)
+		{
+			++itBundle;
+		}
+		itBundle = m_dequeOpen.insert(itBundle, std::move(sBundle));
+	}
+
+	itBundle->vecPackets[uiInput] = rptrPacket;
+	itBundle->uiInputMask |= uiInputBit;
+
+	// hand out complete bundles, older incomplete ones would break the timestamp order
+	size_t uiLastComplete = m_dequeOpen.size();
+	for (size_t i = 0; i < m_dequeOpen.size(); i++)
+	{
+		if (IsComplete(m_dequeOpen[i]))
+			uiLastComplete = i;
+	}
+
+	if (uiLastComplete < m_dequeOpen.size())
+	{
+		for (size_t i = 0; i <= uiLastComplete; i++)
+		{
+			if (IsComplete(m_dequeOpen.front()))
+			{
+				rvecComplete.push_back(std::move(m_dequeOpen.front()));
+				m_uiComplete++;
+			}
+			else
+			{
+				m_uiDropped++;
+			}
+			m_dequeOpen.pop_front();
+		}
+	}
+
+	// drop the bundles which can not be completed any more
+	for (auto it = m_dequeOpen.begin(); it != m_dequeOpen.end();)
+	{
+		if (IsStale(*it))
+		{
+			it = m_dequeOpen.erase(it);
+			m_uiDropped++;
+		}
+		else
+		{
+			++it;
+		}
+	}
+
+	while (m_dequeOpen.size() > m_uiMaxOpen)
+	{
+		m_dequeOpen.pop_front();
+		m_uiDropped++;
+	}
+}
+
+void CBundleAssembler::Reset()
+{
+	m_dequeOpen.clear();
+	m_uiSeenMask = 0;
+}
+
+bool CBundleAssembler::IsComplete(const SBundle& rsBundle) const
+{
+	return m_uiExpectedMask != 0 && (rsBundle.uiInputMask & m_uiExpectedMask) == m_uiExpectedMask;
+}
+
+bool CBundleAssembler::IsStale(const SBundle& rsBundle) const
+{
+	// a missing input which already delivered a packet beyond the tolerance window will never fill the gap
+	const uint32_t uiMissing = m_uiExpectedMask & ~rsBundle.uiInputMask;
+	for (size_t i = 0; i < m_uiInputs; i++)
+	{
+		const uint32_t uiInputBit = 1u << i;
+		if ((uiMissing & uiInputBit) && (m_uiSeenMask & uiInputBit) &&
+			m_vecLastTimestamp[i] > rsBundle.uiTimestamp + m_uiTolerance)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
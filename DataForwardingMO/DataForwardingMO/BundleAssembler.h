@@ -0,0 +1,107 @@
+/******************************************************************************/
+/*! \file
+*
+* \verbatim
+******************************************************************************
+*                                                                            *
+*    Copyright (c) 2015-2026, b-plus technologies GmbH.                      *
+*                                                                            *
+*    All rights are reserved by b-plus technologies GmbH.                    *
+*    The Customer is entitled to modify this software under his              *
+*    own license terms.                                                      *
+*                                                                            *
+*    You may use this code according to the license terms of b-plus.         *
+*    Please contact b-plus at services@b-plus.com to get the actual          *
+*    terms and conditions.                                                   *
+*                                                                            *
+******************************************************************************
+\endverbatim
+*
+* \brief Data Forwarding MO - timestamp bundles of several inputs
+* \author Christopher Maneth
+* \copyright (C)2015-2026 b-plus technologies GmbH
+* \date 19.10.2026
+* \version 2.5
+*
+******************************************************************************/
+
+
+#pragma once
+
+#include <Core/AvCore.h>
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <vector>
+
+/**
+ * \brief Packets of several inputs with matching timestamps.
+ */
+struct SBundle
+{
+	uint64_t												uiTimestamp = 0;	//!< Timestamp of the first packet, reference of the tolerance window
+	std::vector<std::shared_ptr<AvCore::SDataPacketPtr>>	vecPackets;			//!< One packet per input, nullptr if the input is not part of the bundle
+	uint32_t												uiInputMask = 0;	//!< Inputs which contributed a packet
+};
+
+/**
+ * \brief Groups the packets of several inputs by timestamp.
+ *		A bundle collects one packet per input, all within the tolerance of the first one. It is
+ *		complete once every expected input contributed. Bundles are only handed out complete and
+ *		in timestamp order; a bundle which can not be completed any more (an input delivered a newer
+ *		packet already) or is overtaken by a complete bundle is dropped as a whole.
+ *		Packets of each input are expected in timestamp order.
+ */
+class CBundleAssembler
+{
+public:
+	/**
+	 * \param[in] uiInputs Number of inputs.
+	 * \param[in] uiMaxOpen Maximum number of incomplete bundles, the oldest ones are dropped beyond.
+	 */
+	CBundleAssembler(size_t uiInputs, size_t uiMaxOpen);
+
+	/**
+	 * \brief Sets the maximum timestamp difference of the packets of one bundle.
+	 */
+	void SetTolerance(uint64_t uiTolerance) { m_uiTolerance = uiTolerance; }
+
+	/**
+	 * \brief Sets the inputs a bundle has to contain to be complete (bit n = input n).
+	 */
+	void SetExpectedInputs(uint32_t uiInputMask) { m_uiExpectedMask = uiInputMask; }
+
+	/**
+	 * \brief Adds a packet.
+	 * \param[in] uiInput Index of the input.
+	 * \param[in] uiTimestamp Timestamp of the packet.
+	 * \param[in] rptrPacket The packet.
+	 * \param[out] rvecComplete Bundles completed by this packet are appended.
+	 */
+	void Add(size_t uiInput, uint64_t uiTimestamp, const std::shared_ptr<AvCore::SDataPacketPtr>& rptrPacket,
+		std::vector<SBundle>& rvecComplete);
+
+	/**
+	 * \brief Discards all incomplete bundles (they are not counted as dropped).
+	 */
+	void Reset();
+
+	uint64_t GetCompleteCount() const { return m_uiComplete; }
+	uint64_t GetDroppedCount() const { return m_uiDropped; }
+
+private:
+	bool IsComplete(const SBundle& rsBundle) const;
+
+	bool IsStale(const SBundle& rsBundle) const;
+
+	size_t													m_uiInputs;
+	size_t													m_uiMaxOpen;
+	uint64_t												m_uiTolerance = 0;
+	uint32_t												m_uiExpectedMask = 0;
+	std::deque<SBundle>										m_dequeOpen;		//!< Incomplete bundles, oldest first
+	std::vector<uint64_t>									m_vecLastTimestamp;	//!< Newest timestamp per input
+	uint32_t												m_uiSeenMask = 0;	//!< Inputs with a valid m_vecLastTimestamp
+	uint64_t												m_uiComplete = 0;
+	uint64_t												m_uiDropped = 0;
+};
@@ -0,0 +1,138 @@
+/******************************************************************************/
+/*! \file
+*
+* \verbatim
+******************************************************************************
+*                                                                            *
+*    Copyright (c) 2015-2026, b-plus technologies GmbH.                      *
+*                                                                            *
+*    All rights are reserved by b-plus technologies GmbH.                    *
+*    The Customer is entitled to modify this software under his              *
+*    own license terms.                                                      *
+*                                                                            *
+*    You may use this code according to the license terms of b-plus.         *
+*    Please contact b-plus at services@b-plus.com to get the actual          *
+*    terms and conditions.                                                   *
+*                                                                            *
+******************************************************************************
+\endverbatim
+*
+* \brief Data Forwarding MO - shared encode worker pool
+* \author Christopher Maneth
+* \copyright (C)2015-2026 b-plus technologies GmbH
+* \date 19.10.2026
+* \version 2.5
+*
+******************************************************************************/
+
+
+#include "EncodePool.h"
+
+#include <algorithm>
+
+std::shared_ptr<CEncodePool> CEncodePool::GetShared()
+{
+	static std::mutex mtxShared;
+	static std::weak_ptr<CEncodePool> ptrShared;
+
+	std::unique_lock<std::mutex> lock(mtxShared);
+	auto ptrPool = ptrShared.lock();
+	if (!ptrPool)
+	{
+		ptrPool = std::make_shared<CEncodePool>();
+		ptrShared = ptrPool;
+	}
+
+	return ptrPool;
+}
+
+CEncodePool::~CEncodePool()
+{
+	{ // lock
+		std::unique_lock<std::mutex> lock(m_mtx);
+		m_bActive = false;
+	}
+
+	m_cvTasks.notify_all();
+	for (auto& rWorker : m_vecWorkers)
+	{
+		rWorker.join();
+	}
+}
+
+void CEncodePool::Reserve(uint32_t uiWorkers)
+{
+	std::unique_lock<std::mutex> lock(m_mtx);
+	while (m_vecWorkers.size() < uiWorkers)
+	{
+		m_vecWorkers.emplace_back(&CEncodePool::WorkerLoop, this, m_vecWorkers.size());
+	}
+}
+
+uint32_t CEncodePool::GetWorkerCount()
+{
+	std::unique_lock<std::mutex> lock(m_mtx);
+	return static_cast<uint32_t>(m_vecWorkers.size());
+}
+
+std::shared_ptr<SEncodeQueue> CEncodePool::AddQueue()
+{
+	auto ptrQueue = std::make_shared<SEncodeQueue>();
+
+	std::unique_lock<std::mutex> lock(m_mtx);
+	m_vecQueues.push_back(ptrQueue);
+
+	return ptrQueue;
+}
+
+void CEncodePool::RemoveQueue(const std::shared_ptr<SEncodeQueue>& rptrQueue)
+{
+	std::unique_lock<std::mutex> lock(m_mtx);
+	rptrQueue->dequeTasks.clear();
+	m_vecQueues.erase(std::remove(m_vecQueues.begin(), m_vecQueues.end(), rptrQueue), m_vecQueues.end());
+}
+
+void CEncodePool::Push(SEncodeQueue& rQueue, std::function<void()> fnTask)
+{
+	{ // lock
+		std::unique_lock<std::mutex> lock(m_mtx);
+		rQueue.dequeTasks.push_back(std::move(fnTask));
+	}
+
+	m_cvTasks.notify_one();
+}
+
+void CEncodePool::WorkerLoop(size_t uiWorker)
+{
+	std::function<void()> fnTask;
+	while (PopTask(uiWorker, fnTask))
+	{
+		fnTask();
+		fnTask = nullptr;
+	}
+}
+
+bool CEncodePool::PopTask(size_t uiWorker, std::function<void()>& rfnTask)
+{
+	std::unique_lock<std::mutex> lock(m_mtx);
+
+	while (m_bActive)
+	{
+		// start with the home queue of this worker, then steal from the other channels
+		const size_t uiQueues = m_vecQueues.size();
+		for (size_t i = 0; i < uiQueues; i++)
+		{
+			auto& rdequeTasks = m_vecQueues[(uiWorker + i) % uiQueues]->dequeTasks;
+			if (rdequeTasks.empty())
+				continue;
+
+			rfnTask = std::move(rdequeTasks.front());
+			rdequeTasks.pop_front();
+			return true;
+		}
+
+		m_cvTasks.wait(lock);
+	}
+
+	return false;
+}
@@ -0,0 +1,97 @@
+/******************************************************************************/
+/*! \file
+*
+* \verbatim
+******************************************************************************
+*                                                                            *
+*    Copyright (c) 2015-2026, b-plus technologies GmbH.                      *
+*                                                                            *
+*    All rights are reserved by b-plus technologies GmbH.                    *
+*    The Customer is entitled to modify this software under his              *
+*    own license terms.                                                      *
+*                                                                            *
+*    You may use this code according to the license terms of b-plus.         *
+*    Please contact b-plus at services@b-plus.com to get the actual          *
+*    terms and conditions.                                                   *
+*                                                                            *
+******************************************************************************
+\endverbatim
+*
+* \brief Data Forwarding MO - shared encode worker pool
+* \author Christopher Maneth
+* \copyright (C)2015-2026 b-plus technologies GmbH
+* \date 19.10.2026
+* \version 2.5
+*
+******************************************************************************/
+
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * \brief Task queue of one forwarding channel, created by CEncodePool::AddQueue().
+ */
+struct SEncodeQueue
+{
+	std::deque<std::function<void()>>	dequeTasks;				//!< Protected by the pool mutex
+};
+
+/**
+ * \brief Worker threads which encode the frames of all forwarding channels of the process.
+ *		Every channel pushes its tasks to its own queue. A worker serves the queue of its "home"
+ *		channel first and steals from the other queues when it ran empty, so idle workers help
+ *		the busy channels. Tasks of one queue may complete in any order, the channels restore
+ *		the order before sending.
+ */
+class CEncodePool
+{
+public:
+	/**
+	 * \brief Returns the pool shared by all forwarding channels, it is created on first use and
+	 *		destroyed with its last user.
+	 */
+	static std::shared_ptr<CEncodePool> GetShared();
+
+	CEncodePool() = default;
+
+	~CEncodePool();
+
+	CEncodePool(const CEncodePool&) = delete;
+	CEncodePool& operator=(const CEncodePool&) = delete;
+
+	/**
+	 * \brief Grows the pool to at least the given number of workers (it never shrinks while in use).
+	 */
+	void Reserve(uint32_t uiWorkers);
+
+	uint32_t GetWorkerCount();
+
+	std::shared_ptr<SEncodeQueue> AddQueue();
+
+	/**
+	 * \brief Removes a queue, tasks still pending in the queue are discarded.
+	 */
+	void RemoveQueue(const std::shared_ptr<SEncodeQueue>& rptrQueue);
+
+	void Push(SEncodeQueue& rQueue, std::function<void()> fnTask);
+
+private:
+	void WorkerLoop(size_t uiWorker);
+
+	bool PopTask(size_t uiWorker, std::function<void()>& rfnTask);
+
+	std::mutex										m_mtx;
+	std::condition_variable							m_cvTasks;				//!< Signals new tasks
+	bool											m_bActive = true;
+	std::vector<std::thread>						m_vecWorkers;
+	std::vector<std::shared_ptr<SEncodeQueue>>		m_vecQueues;
+};
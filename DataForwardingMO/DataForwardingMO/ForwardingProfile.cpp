@@ -0,0 +1,153 @@
+/******************************************************************************/
+/*! \file
+*
+* \verbatim
+******************************************************************************
+*                                                                            *
+*    Copyright (c) 2015-2026, b-plus technologies GmbH.                      *
+*                                                                            *
+*    All rights are reserved by b-plus technologies GmbH.                    *
+*    The Customer is entitled to modify this software under his              *
+*    own license terms.                                                      *
+*                                                                            *
+*    You may use this code according to the license terms of b-plus.         *
+*    Please contact b-plus at services@b-plus.com to get the actual          *
+*    terms and conditions.                                                   *
+*                                                                            *
+******************************************************************************
+\endverbatim
+*
+* \brief Data Forwarding MO - forwarding profiles
+* \author Christopher Maneth
+* \copyright (C)2015-2026 b-plus technologies GmbH
+* \date 19.10.2026
+* \version 2.5
+*
+******************************************************************************/
+
+
+#include "ForwardingProfile.h"
+
+#include <algorithm>
+#include <cctype>
+#include <sstream>
+
+namespace
+{
+	std::vector<std::string> Split(const std::string& ssValue, char cDelimiter)
+	{
+		std::vector<std::string> vecParts;
+		std::stringstream ss(ssValue);
+		std::string ssPart;
+		while (std::getline(ss, ssPart, cDelimiter))
+		{
+			vecParts.push_back(ssPart);
+		}
+		return vecParts;
+	}
+
+	std::string Trim(const std::string& ssValue)
+	{
+		const auto uiBegin = ssValue.find_first_not_of(" \t");
+		if (uiBegin == std::string::npos)
+			return std::string();
+
+		const auto uiEnd = ssValue.find_last_not_of(" \t");
+		return ssValue.substr(uiBegin, uiEnd - uiBegin + 1);
+	}
+
+	bool IsValidName(const std::string& ssName)
+	{
+		if (ssName.empty())
+			return false;
+
+		for (char c : ssName)
+		{
+			if (!isalnum(static_cast<unsigned char>(c)) && c != '_' && c != '-')
+				return false;
+		}
+		return true;
+	}
+
+	bool ParseUInt(const std::string& ssValue, uint32_t& ruiValue)
+	{
+		if (ssValue.empty() || ssValue.find_first_not_of("0123456789") != std::string::npos || ssValue.size() > 9)
+			return false;
+
+		ruiValue = static_cast<uint32_t>(std::stoul(ssValue));
+		return true;
+	}
+}
+
+std::vector<SForwardingProfile> ParseForwardingProfiles(const std::string& ssProfiles, size_t uiMaxProfiles)
+{
+	std::vector<SForwardingProfile> vecProfiles;
+
+	for (const auto& ssEntry : Split(ssProfiles, ';'))
+	{
+		if (vecProfiles.size() >= uiMaxProfiles)
+			break;
+
+		auto vecFields = Split(ssEntry, ':');
+		for (auto& ssField : vecFields)
+		{
+			ssField = Trim(ssField);
+		}
+
+		if (vecFields.empty() || vecFields.size() > 5 || !IsValidName(vecFields[0]))
+			continue;
+
+		// every profile has its own topic, a second entry with the same name would publish every frame twice
+		if (std::any_of(vecProfiles.begin(), vecProfiles.end(), [&](const SForwardingProfile& rsProfile) { return rsProfile.ssName == vecFields[0]; }))
+			continue;
+
+		SForwardingProfile sProfile;
+		sProfile.ssName = vecFields[0];
+
+		if (vecFields.size() > 1 && !ParseUInt(vecFields[1], sProfile.uiFPSLimit))
+			continue;
+
+		if (vecFields.size() > 2)
+		{
+			if (vecFields[2] == "RGBA")
+			{
+				sProfile.bTransform = true;
+				sProfile.sTransform.eFormat = EPayloadFormat::RGBA;
+			}
+			else if (vecFields[2] == "RGB")
+			{
+				sProfile.bTransform = true;
+				sProfile.sTransform.eFormat = EPayloadFormat::RGB;
+			}
+			else if (vecFields[2] != "RAW")
+			{
+				continue;
+			}
+		}
+
+		if (vecFields.size() > 3)
+		{
+			if (!ParseUInt(vecFields[3], sProfile.sTransform.uiScale) || sProfile.sTransform.uiScale < 1 ||
+				sProfile.sTransform.uiScale > PAYLOAD_TRANSFORM_MAX_SCALE)
+			{
+				continue;
+			}
+
+			// RAW payloads are never scaled, only the neutral value is accepted
+			if (!sProfile.bTransform && sProfile.sTransform.uiScale != 1)
+				continue;
+		}
+
+		if (vecFields.size() > 4)
+		{
+			if (vecFields[4] != "0" && vecFields[4] != "1")
+				continue;
+
+			sProfile.bPayload = vecFields[4] == "1";
+		}
+
+		vecProfiles.push_back(sProfile);
+	}
+
+	return vecProfiles;
+}
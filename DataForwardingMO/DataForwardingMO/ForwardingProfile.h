@@ -0,0 +1,63 @@
+/******************************************************************************/
+/*! \file
+*
+* \verbatim
+******************************************************************************
+*                                                                            *
+*    Copyright (c) 2015-2026, b-plus technologies GmbH.                      *
+*                                                                            *
+*    All rights are reserved by b-plus technologies GmbH.                    *
+*    The Customer is entitled to modify this software under his              *
+*    own license terms.                                                      *
+*                                                                            *
+*    You may use this code according to the license terms of b-plus.         *
+*    Please contact b-plus at services@b-plus.com to get the actual          *
+*    terms and conditions.                                                   *
+*                                                                            *
+******************************************************************************
+\endverbatim
+*
+* \brief Data Forwarding MO - forwarding profiles
+* \author Christopher Maneth
+* \copyright (C)2015-2026 b-plus technologies GmbH
+* \date 19.10.2026
+* \version 2.5
+*
+******************************************************************************/
+
+
+#pragma once
+
+#include "PayloadTransform.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * \brief An additional output of the forwarding MO, published on its own topic.
+ */
+struct SForwardingProfile
+{
+	std::string			ssName;										//!< Topic suffix (topic: "profile/<name>")
+	uint32_t			uiFPSLimit = 0;								//!< Forwarding rate (0 = every frame)
+	bool				bTransform = false;							//!< Payload is transformed (RGBA inputs only)
+	SPayloadTransform	sTransform;
+	bool				bPayload = true;							//!< If not set only metadata will be sent
+};
+
+/**
+ * \brief Parses the "Profiles" property.
+ *		Profiles are separated by ';', the fields of a profile by ':' (trailing fields are optional):
+ *		name:fps:format:scale:payload
+ *		- name		topic suffix, [A-Za-z0-9_-]
+ *		- fps		forwarding rate, 0 = every frame (default: 0)
+ *		- format	RAW (unchanged), RGBA or RGB (default: RAW); RGBA and RGB are only sent for RGBA inputs
+ *		- scale		downscale factor for RGBA / RGB, 1 - 64 (default: 1), RAW only accepts 1
+ *		- payload	1 = data and metadata, 0 = metadata only (default: 1)
+ *		Example: "dashboard:2:RGBA:4;detector:15:RGB;logger"
+ * \param[in] ssProfiles The property value.
+ * \param[in] uiMaxProfiles Profiles after this count are ignored.
+ * \return The valid profiles, invalid entries and repeated names are skipped (the first entry wins).
+ */
+std::vector<SForwardingProfile> ParseForwardingProfiles(const std::string& ssProfiles, size_t uiMaxProfiles);
@@ -0,0 +1,111 @@
+/******************************************************************************/
+/*! \file
+*
+* \verbatim
+******************************************************************************
+*                                                                            *
+*    Copyright (c) 2015-2026, b-plus technologies GmbH.                      *
+*                                                                            *
+*    All rights are reserved by b-plus technologies GmbH.                    *
+*    The Customer is entitled to modify this software under his              *
+*    own license terms.                                                      *
+*                                                                            *
+*    You may use this code according to the license terms of b-plus.         *
+*    Please contact b-plus at services@b-plus.com to get the actual          *
+*    terms and conditions.                                                   *
+*                                                                            *
+******************************************************************************
+\endverbatim
+*
+* \brief Data Forwarding MO - payload transforms (format conversion, downscaling)
+* \author Christopher Maneth
+* \copyright (C)2015-2026 b-plus technologies GmbH
+* \date 19.10.2026
+* \version 2.5
+*
+******************************************************************************/
+
+#include "PayloadTransform.h"
+
+const char* GetPayloadFormatName(EPayloadFormat eFormat)
+{
+	switch (eFormat)
+	{
+	case EPayloadFormat::RGB:
+		return "RGB";
+	case EPayloadFormat::RGBA:
+	default:
+		return "RGBA";
+	}
+}
+
+uint32_t GetPayloadFormatBPP(EPayloadFormat eFormat)
+{
+	switch (eFormat)
+	{
+	case EPayloadFormat::RGB:
+		return 24;
+	case EPayloadFormat::RGBA:
+	default:
+		return 32;
+	}
+}
+
+void TransformRGBA(const SPayloadTransform& rsTransform, const uint8_t* pSrc, uint32_t uiWidth, uint32_t uiHeight,
+	std::vector<uint8_t>& rvecDst, uint32_t& ruiDstWidth, uint32_t& ruiDstHeight)
+{
+	const uint32_t uiScale = rsTransform.uiScale < 1 ? 1 : rsTransform.uiScale;
+	const uint32_t uiDstChannels = GetPayloadFormatBPP(rsTransform.eFormat) / 8;
+
+	ruiDstWidth = uiWidth / uiScale;
+	ruiDstHeight = uiHeight / uiScale;
+	rvecDst.resize(static_cast<size_t>(ruiDstWidth) * ruiDstHeight * uiDstChannels);
+
+	uint8_t* pDst = rvecDst.data();
+
+	if (uiScale == 1)
+	{
+		// format conversion only
+		const size_t uiPixels = static_cast<size_t>(uiWidth) * uiHeight;
+		for (size_t i = 0; i < uiPixels; i++)
+		{
+			for (uint32_t c = 0; c < uiDstChannels; c++)
+			{
+				pDst[i * uiDstChannels + c] = pSrc[i * 4 + c];
+			}
+		}
+		return;
+	}
+
+	// box filter: every destination pixel is the mean of a uiScale x uiScale source block
+	const size_t uiSrcStride = static_cast<size_t>(uiWidth) * 4;
+	const uint32_t uiBlockPixels = uiScale * uiScale;
+
+	for (uint32_t y = 0; y < ruiDstHeight; y++)
+	{
+		const uint8_t* pSrcRow = pSrc + static_cast<size_t>(y) * uiScale * uiSrcStride;
+		uint8_t* pDstRow = pDst + static_cast<size_t>(y) * ruiDstWidth * uiDstChannels;
+
+		for (uint32_t x = 0; x < ruiDstWidth; x++)
+		{
+			uint32_t auiSum[4] = { 0, 0, 0, 0 };
+
+			for (uint32_t by = 0; by < uiScale; by++)
+			{
+				const uint8_t* pBlock = pSrcRow + by * uiSrcStride + static_cast<size_t>(x) * uiScale * 4;
+				for (uint32_t bx = 0; bx < uiScale; bx++)
+				{
+					auiSum[0] += pBlock[bx * 4 + 0];
+					auiSum[1] += pBlock[bx * 4 + 1];
+					auiSum[2] += pBlock[bx * 4 + 2];
+					auiSum[3] += pBlock[bx * 4 + 3];
+				}
+			}
+
+			for (uint32_t c = 0; c < uiDstChannels; c++)
+			{
+				pDstRow[x * uiDstChannels + c] = static_cast<uint8_t>(auiSum[c] / uiBlockPixels);
+			}
+		}
+	}
+}
@@ -0,0 +1,87 @@
+/******************************************************************************/
+/*! \file
+*
+* \verbatim
+******************************************************************************
+*                                                                            *
+*    Copyright (c) 2015-2026, b-plus technologies GmbH.                      *
+*                                                                            *
+*    All rights are reserved by b-plus technologies GmbH.                    *
+*    The Customer is entitled to modify this software under his              *
+*    own license terms.                                                      *
+*                                                                            *
+*    You may use this code according to the license terms of b-plus.         *
+*    Please contact b-plus at services@b-plus.com to get the actual          *
+*    terms and conditions.                                                   *
+*                                                                            *
+******************************************************************************
+\endverbatim
+*
+* \brief Data Forwarding MO - payload transforms (format conversion, downscaling)
+* \author Christopher Maneth
+* \copyright (C)2015-2026 b-plus technologies GmbH
+* \date 19.10.2026
+* \version 2.5
+*
+******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#define PAYLOAD_TRANSFORM_MAX_SCALE		(64)						// keeps the box filter sums within 32 bit
+
+/**
+ * \brief Pixel formats a RGBA input can be converted to.
+ */
+enum class EPayloadFormat : uint32_t
+{
+	RGBA = 0,
+	RGB = 1
+};
+
+/**
+ * \brief Describes how the payload of a RGBA input is transformed before forwarding.
+ */
+struct SPayloadTransform
+{
+	EPayloadFormat		eFormat = EPayloadFormat::RGBA;
+	uint32_t			uiScale = 1;								//!< Downscale factor (1 = full resolution, at most PAYLOAD_TRANSFORM_MAX_SCALE)
+
+	bool IsIdentity() const { return eFormat == EPayloadFormat::RGBA && uiScale <= 1; }
+
+	bool operator==(const SPayloadTransform& rOther) const
+	{
+		return eFormat == rOther.eFormat && uiScale == rOther.uiScale;
+	}
+
+	bool operator<(const SPayloadTransform& rOther) const
+	{
+		return eFormat != rOther.eFormat ? eFormat < rOther.eFormat : uiScale < rOther.uiScale;
+	}
+};
+
+/**
+ * \brief Returns the format name used in the forwarding message ("RGBA", "RGB").
+ */
+const char* GetPayloadFormatName(EPayloadFormat eFormat);
+
+/**
+ * \brief Returns the bits per pixel of the format.
+ */
+uint32_t GetPayloadFormatBPP(EPayloadFormat eFormat);
+
+/**
+ * \brief Transforms a RGBA image.
+ * \param[in] rsTransform The transform to apply.
+ * \param[in] pSrc The RGBA source image (uiWidth * uiHeight * 4 bytes).
+ * \param[in] uiWidth Width of the source image.
+ * \param[in] uiHeight Height of the source image.
+ * \param[out] rvecDst Receives the transformed image. Its capacity is reused between calls.
+ * \param[out] ruiDstWidth Width of the transformed image.
+ * \param[out] ruiDstHeight Height of the transformed image.
+ */
+void TransformRGBA(const SPayloadTransform& rsTransform, const uint8_t* pSrc, uint32_t uiWidth, uint32_t uiHeight,
+	std::vector<uint8_t>& rvecDst, uint32_t& ruiDstWidth, uint32_t& ruiDstHeight);
@@ -4,7 +4,7 @@
 * \verbatim
 ******************************************************************************
 *                                                                            *
-*    Copyright (c) 2015-2022, b-plus technologies GmbH.                      *
+*    Copyright (c) 2015-2026, b-plus technologies GmbH.                      *
 *                                                                            *
 *    All rights are reserved by b-plus technologies GmbH.                    *
 *    The Customer is entitled to modify this software under his              *
@@ -19,9 +19,9 @@
 *
 * \brief Data Forwarding MO
 * \author Christopher Maneth
-* \copyright (C)2015-2022 b-plus technologies GmbH
-* \date 04.05.2022
-* \version 2.4
+* \copyright (C)2015-2026 b-plus technologies GmbH
+* \date 19.10.2026
+* \version 2.5
 *
 ******************************************************************************/
 
@@ -29,19 +29,62 @@
 
 using namespace std::chrono_literals;
 
+namespace
+{
+	void WriteLE16(uint8_t* pDst, uint16_t uiValue)
+	{
+		pDst[0] = static_cast<uint8_t>(uiValue);
+		pDst[1] = static_cast<uint8_t>(uiValue >> 8);
+	}
+
+	void WriteLE32(uint8_t* pDst, uint32_t uiValue)
+	{
+		WriteLE16(pDst, static_cast<uint16_t>(uiValue));
+		WriteLE16(pDst + 2, static_cast<uint16_t>(uiValue >> 16));
+	}
+}
+
 
 CProcessorObject::CProcessorObject() :
 	m_uiFPSLimit(5),
 	m_bNoPayload(false),
-	m_uiInputWidth(0),
-	m_uiInputHeight(0),
-	m_uiInputBPP(0),
-	m_bInputIsRGBA(false),
+	m_uiPacingMode(0),
+	m_uiDecimation(1),
+	m_uiPacketIndex(0),
+	m_uiLastTimestamp(0),
+	m_uiChunkThreshold(0),
+	m_uiChunkSize(ZEROMQ_CHUNK_SIZE),
+	m_uiEncodeThreads(0),
+	m_uiBundleTolerance(5000),
+	m_vecBundleInputs(ZEROMQ_BUNDLE_INPUTS),
+	m_BundleAssembler(ZEROMQ_BUNDLE_INPUTS, ZEROMQ_BUNDLE_OPEN_LIMIT),
+	m_uiBundleIndex(0),
+	m_uiLastBundleTimestamp(0),
+	m_uiSubscribersBundle(0),
+	m_uiBundlesDropped(0),
+	m_uiBundlesNotEncoded(0),
 	m_ZeroMQThread(),
-	m_ZmqSock(m_ZmqCtx, zmq::socket_type::pub),
+	m_ZmqSock(m_ZmqCtx, zmq::socket_type::xpub),
 	m_bZeroMQActive(false),
-	m_iZmqChannel(0)
+	m_iZmqChannel(0),
+	m_bNoDrop(false),
+	m_ssMulticastInterface(ZEROMQ_RADIO_INTERFACE),
+	m_bRadioConnected(false),
+	m_uiSubscribers(0),
+	m_uiSubscribersRGB(0),
+	m_uiSubscribersHalf(0),
+	m_uiSubscribersQuarter(0),
+	m_uiNextSequence(0),
+	m_uiPoolWaitTime(0),
+	m_uiEncodeTime(0),
+	m_uiReorderTime(0),
+	m_uiSendTime(0)
 {
+	m_sBundleStream.ssTopic = ZEROMQ_TOPIC_BUNDLE;
+	m_sBundleStream.bDefaultFPS = true;
+	m_sBundleStream.bDefaultPayload = true;
+
+	UpdateProfiles();
 }
 
 AVETO::Core::TStatus CProcessorObject::Initialize()
@@ -49,6 +92,8 @@ AVETO::Core::TStatus CProcessorObject::Initialize()
 	try
 	{
 		m_ZmqSock.setsockopt(ZMQ_SNDHWM, 3);
+		m_ZmqSock.setsockopt(ZMQ_XPUB_VERBOSER, 1);						// report every (un)subscription to count subscribers
+		m_ZmqSock.setsockopt(ZMQ_SNDTIMEO, ZEROMQ_SEND_TIMEOUT_MS);		// bounds blocking sends in no drop mode
 
 		for (m_iZmqChannel = 0; m_iZmqChannel < ZEROMQ_CHANNEL_LIMIT; m_iZmqChannel++)
 		{
@@ -66,7 +111,7 @@ AVETO::Core::TStatus CProcessorObject::Initialize()
 			}
 		}
 
-		m_bZeroMqActive = true;
+		m_bZeroMQActive = true;
 		m_ZeroMQThread = std::thread(&CProcessorObject::ZeroMQLoop, this);
 	}
 	catch (std::exception e)
@@ -82,7 +127,14 @@ AVETO::Core::TStatus CProcessorObject::Terminate()
 	// Reset the initialized flag.
 	AVETO::Dev::Support::CAvetoProcessorObject::Terminate();
 
-	m_bZeroMqActive = false;
+	{ // lock
+		// under the lock, so a data thread can not miss the change between checking it and waiting for queue space
+		std::unique_lock<std::mutex> lock(m_mtxPacketQueue);
+		m_bZeroMQActive = false;
+	}
+
+	m_cvPacketQueue.notify_all();
+	m_cvQueueSpace.notify_all();
 	if (m_ZeroMQThread.get_id() != std::thread::id()) 
 		m_ZeroMQThread.join();
 
@@ -93,107 +145,1003 @@ AVETO::Core::TStatus CProcessorObject::Terminate()
 
 int CProcessorObject::ZeroMQLoop()
 {
-	while (m_bZeroMqActive)
+	std::vector<std::shared_ptr<AvCore::SDataPacketPtr>> vecPackets;
+	std::vector<std::pair<size_t, std::shared_ptr<AvCore::SDataPacketPtr>>> vecBundlePackets;
+	std::vector<const SOutputStream*> vecSelected;
+	SInputInfo sInput;
+	std::vector<SInputInfo> vecBundleInputs;
+
+	while (m_bZeroMQActive)
 	{
-		auto target_fps = m_uiFPSLimit;
-		if (target_fps < 1)
-			target_fps = 1;
+		UpdateProfiles();
+		UpdateSubscriptions();
+		UpdateEncodePool(GetEncodeThreads());
+		UpdateMulticast();
 
-		std::this_thread::sleep_for(1000ms / target_fps);						// limit to max FPS
+		// replay pacing is lossless, subscribers which do not keep up slow down the forwarding instead
+		const EPacingMode ePacing = GetPacingMode();
+		SetNoDrop(ePacing != EPacingMode::WallClock);
 
 		{ // lock
 			std::unique_lock<std::mutex> lock(m_mtxPacketQueue);
 
-			// remove all but newest item from queue
-			while (m_queuePackets.size() > 1)
+			// wake up regularly to keep the subscriptions up to date
+			m_cvPacketQueue.wait_for(lock, 100ms, [this]
+			{
+				return !m_queuePackets.empty() || !m_queueBundlePackets.empty() || !m_bZeroMQActive ||
+					(!m_dequeJobs.empty() && (m_dequeJobs.front()->bEncoded || !m_dequeJobs.front()->dequeParts.empty()));
+			});
+
+			while (!m_queuePackets.empty())
 			{
+				vecPackets.push_back(std::move(m_queuePackets.front()));
 				m_queuePackets.pop();
 			}
 
-			if (!m_queuePackets.empty())
+			while (!m_queueBundlePackets.empty())
 			{
-				if(BuildMsgBuffer())
-					SendMsgBuffer();
-
-				m_queuePackets.pop();
+				vecBundlePackets.push_back(std::move(m_queueBundlePackets.front()));
+				m_queueBundlePackets.pop();
 			}
+
+			sInput = m_sInput;
+			vecBundleInputs = m_vecBundleInputs;
 		}
+
+		m_cvQueueSpace.notify_all();
+
+		const size_t uiMaxJobs = std::max<size_t>(1, GetEncodeThreads() * ZEROMQ_ENCODE_JOBS_PER_THREAD);
+		const auto tNow = std::chrono::steady_clock::now();
+		for (size_t i = 0; i < vecPackets.size(); i++)
+		{
+			SelectStreams(i + 1 == vecPackets.size(), tNow, vecPackets[i]->GetTimestamp(), vecSelected);
+
+			if (vecSelected.empty())
+				continue;
+
+			// make room in the pipeline, the encode threads hold back the input instead of growing without bounds
+			SendEncoded(uiMaxJobs - 1);
+			SubmitFrame(vecPackets[i], sInput, vecSelected);
+		}
+
+		vecPackets.clear();
+
+		if (!vecBundlePackets.empty())
+			ForwardBundles(vecBundlePackets, vecBundleInputs, tNow, uiMaxJobs);
+
+		vecBundlePackets.clear();
+
+		// send whatever is ready without waiting
+		SendEncoded(m_dequeJobs.size());
 	}
 
+	// the encode threads may still reference frames of this object
+	// the property keeps its value, the pool is only left for this run
+	SendEncoded(0);
+	UpdateEncodePool(0);
+
+#if defined(ZMQ_BUILD_DRAFT_API)
+	m_RadioSock.close();
+#endif
 	m_ZmqSock.close();
 
 	return 0;
 }
 
-bool CProcessorObject::BuildMsgBuffer()
+void CProcessorObject::UpdateProfiles()
 {
-	const auto frame = m_queuePackets.front();
+	const std::string ssProfiles = m_ssProfiles.Get();
+
+	if (!m_vecStreams.empty() && ssProfiles == m_ssParsedProfiles)
+		return;
+
+	m_ssParsedProfiles = std::move(ssProfiles);
+	m_vecStreams.clear();
+
+	SOutputStream sStream;
+	sStream.bDefaultFPS = true;
+
+	// default stream and the optional RGBA variants
+	sStream.ssTopic = ZEROMQ_TOPIC;
+	sStream.bDefaultPayload = true;
+	m_vecStreams.push_back(sStream);
 
-	const std::string ssSource = ZEROMQ_SOURCE;
-	std::string ssType = "raw";
-	std::string ssFormat = "RAW";
-	std::array<int, 3> aFormatSize{ { 0, 0, 0 } };
-	uint32_t uiNumBytes = 0;
+	sStream.bDefaultPayload = false;
+	sStream.sEncoding.bTransform = true;
+	sStream.ssTopic = ZEROMQ_TOPIC_RGB;
+	sStream.sEncoding.sTransform = { EPayloadFormat::RGB, 1 };
+	m_vecStreams.push_back(sStream);
+	sStream.ssTopic = ZEROMQ_TOPIC_HALF;
+	sStream.sEncoding.sTransform = { EPayloadFormat::RGBA, 2 };
+	m_vecStreams.push_back(sStream);
+	sStream.ssTopic = ZEROMQ_TOPIC_QUARTER;
+	sStream.sEncoding.sTransform = { EPayloadFormat::RGBA, 4 };
+	m_vecStreams.push_back(sStream);
 
-	if (m_bNoPayload)												// METADATA_ONLY
+	// user defined profiles
+	for (const auto& rsProfile : ParseForwardingProfiles(m_ssParsedProfiles, ZEROMQ_PROFILE_LIMIT))
 	{
-		ssType = "metadata_only";
+		SOutputStream sProfileStream;
+		sProfileStream.ssTopic = std::string(ZEROMQ_TOPIC_PROFILE) + rsProfile.ssName;
+		sProfileStream.uiFPSLimit = rsProfile.uiFPSLimit;
+		sProfileStream.sEncoding.bTransform = rsProfile.bTransform;
+		sProfileStream.sEncoding.sTransform = rsProfile.sTransform;
+		sProfileStream.sEncoding.bPayload = rsProfile.bPayload;
+		m_vecStreams.push_back(sProfileStream);
 	}
-	else if (m_bInputIsRGBA)										// RGBA
+
+	ApplyMulticastTopics();
+	CountSubscribers();
+}
+
+void CProcessorObject::UpdateSubscriptions()
+{
+	// XPUB delivers (un)subscriptions as messages: first byte 1 = subscribe, 0 = unsubscribe, followed by the topic
+	bool bChanged = false;
+	zmq::message_t msg;
+	while (m_ZmqSock.recv(msg, zmq::recv_flags::dontwait))
 	{
-		uiNumBytes = m_uiInputWidth * m_uiInputHeight * 4;
+		if (msg.size() == 0)
+			continue;
 
-		if (uiNumBytes != frame->GetDataLen())
-			return false;  // invalid package size for type
-				
-		ssType = "image";
-		ssFormat = "RGBA";
-		aFormatSize[0] = m_uiInputWidth;
-		aFormatSize[1] = m_uiInputHeight;
-		aFormatSize[2] = 32;		
+		const auto* pData = static_cast<const char*>(msg.data());
+		const std::string ssTopic(pData + 1, msg.size() - 1);
+
+		if (pData[0] == 1)
+		{
+			m_mapSubscriptions[ssTopic]++;
+			bChanged = true;
+		}
+		else if (pData[0] == 0)
+		{
+			auto it = m_mapSubscriptions.find(ssTopic);
+			if (it != m_mapSubscriptions.end() && --it->second == 0)
+				m_mapSubscriptions.erase(it);
+			bChanged = true;
+		}
 	}
-	else															// RAW / OTHER
+
+	if (bChanged)
+		CountSubscribers();
+}
+
+void CProcessorObject::CountSubscribers()
+{
+	// a subscription matches every topic it is a prefix of
+	const auto fnCount = [this](SOutputStream& rsStream)
+	{
+		rsStream.uiSubscribers = 0;
+		for (const auto& rSubscription : m_mapSubscriptions)
+		{
+			if (rsStream.ssTopic.compare(0, rSubscription.first.size(), rSubscription.first) == 0)
+				rsStream.uiSubscribers += rSubscription.second;
+		}
+	};
+
+	for (auto& rsStream : m_vecStreams)
 	{
-		uiNumBytes = frame->GetDataLen();
-		ssFormat = m_ssInputName;
-		aFormatSize[0] = m_uiInputWidth;
-		aFormatSize[1] = m_uiInputHeight;
-		aFormatSize[2] = m_uiInputBPP;
+		fnCount(rsStream);
 	}
+	fnCount(m_sBundleStream);
 
-	msgpack::packer<msgpack::sbuffer> packer(&m_MsgBuffer);
-	packer.pack(ssSource);
-	packer.pack(frame->GetTimestamp());
-	packer.pack(ssType);
-	packer.pack(ssFormat);
-	packer.pack(aFormatSize);
-	packer.pack_bin(uiNumBytes);
-	if (uiNumBytes > 0)
+	m_uiSubscribers = m_vecStreams[0].uiSubscribers;
+	m_uiSubscribersRGB = m_vecStreams[1].uiSubscribers;
+	m_uiSubscribersHalf = m_vecStreams[2].uiSubscribers;
+	m_uiSubscribersQuarter = m_vecStreams[3].uiSubscribers;
+	m_uiSubscribersBundle = m_sBundleStream.uiSubscribers;
+
+	std::string ssProfileSubscribers;
+	for (size_t i = 4; i < m_vecStreams.size(); i++)
+	{
+		if (!ssProfileSubscribers.empty())
+			ssProfileSubscribers += ";";
+
+		ssProfileSubscribers += m_vecStreams[i].ssTopic.substr(strlen(ZEROMQ_TOPIC_PROFILE)) + "=" +
+			std::to_string(m_vecStreams[i].uiSubscribers);
+	}
+
+	m_ssProfileSubscribers.Set(std::move(ssProfileSubscribers));
+}
+
+CProcessorObject::EPacingMode CProcessorObject::GetPacingMode() const
+{
+	switch (m_uiPacingMode)
+	{
+	case static_cast<uint32_t>(EPacingMode::Timestamp):
+		return EPacingMode::Timestamp;
+	case static_cast<uint32_t>(EPacingMode::Decimation):
+		return EPacingMode::Decimation;
+	default:
+		return EPacingMode::WallClock;
+	}
+}
+
+void CProcessorObject::SelectStreams(bool bNewest, std::chrono::steady_clock::time_point tNow, uint64_t uiTimestamp,
+	std::vector<const SOutputStream*>& rvecSelected)
+{
+	rvecSelected.clear();
+
+	const EPacingMode ePacing = GetPacingMode();
+
+	// a jump back in time means the recording is replayed again, start counting from its beginning
+	if (uiTimestamp < m_uiLastTimestamp)
+		m_uiPacketIndex = 0;
+
+	const uint64_t uiPacketIndex = m_uiPacketIndex++;
+	m_uiLastTimestamp = uiTimestamp;
+
+	for (auto& rsStream : m_vecStreams)
 	{
-		packer.pack_bin_body(static_cast<const char*>(frame->GetData()), uiNumBytes);
+		if (SelectStream(rsStream, ePacing, bNewest, tNow, uiTimestamp, uiPacketIndex))
+			rvecSelected.push_back(&rsStream);
+	}
+}
+
+bool CProcessorObject::SelectStream(SOutputStream& rsStream, EPacingMode ePacing, bool bNewest, std::chrono::steady_clock::time_point tNow,
+	uint64_t uiTimestamp, uint64_t uiPacketIndex)
+{
+	if (rsStream.uiSubscribers == 0 && !rsStream.bMulticast)
+		return false;											// topics nobody subscribed to are not encoded at all
+
+	if (rsStream.bDefaultPayload)
+		rsStream.sEncoding.bPayload = !m_bNoPayload;
+
+	uint32_t uiFPSLimit = rsStream.uiFPSLimit;
+	if (rsStream.bDefaultFPS)
+		uiFPSLimit = m_uiFPSLimit < 1 ? 1 : m_uiFPSLimit;
+
+	if (uiFPSLimit == 0)
+		return true;
+
+	if (ePacing == EPacingMode::Timestamp)
+	{
+		// the intervals are aligned to timestamp 0, so the selection does not depend on the replay speed
+		const uint64_t uiInterval = std::max<uint64_t>(1, ZEROMQ_TIMESTAMP_RESOLUTION / uiFPSLimit);
+		const uint64_t uiSlot = uiTimestamp / uiInterval;
+		if (rsStream.bLastSlotValid && rsStream.uiLastSlot == uiSlot)
+			return false;
+
+		rsStream.uiLastSlot = uiSlot;
+		rsStream.bLastSlotValid = true;
+	}
+	else if (ePacing == EPacingMode::Decimation)
+	{
+		// N applies to the "FPS Limit" streams, profiles with their own rate keep their ratio to it
+		const uint64_t uiDefaultFPS = m_uiFPSLimit < 1 ? 1 : m_uiFPSLimit;
+		const uint64_t uiDecimation = std::max<uint64_t>(1,
+			((m_uiDecimation < 1 ? 1 : m_uiDecimation) * uiDefaultFPS + uiFPSLimit / 2) / uiFPSLimit);
+		if (uiPacketIndex % uiDecimation != 0)
+			return false;
+	}
+	else
+	{
+		// rate limited streams only forward the newest packet once it is due
+		if (!bNewest || tNow < rsStream.tNextDue)
+			return false;
+
+		const auto tInterval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(1000ms) / uiFPSLimit;
+		rsStream.tNextDue += tInterval;
+		if (rsStream.tNextDue <= tNow)
+			rsStream.tNextDue = tNow + tInterval;
 	}
 
 	return true;
 }
 
-void CProcessorObject::SendMsgBuffer()
+void CProcessorObject::ForwardBundles(std::vector<std::pair<size_t, std::shared_ptr<AvCore::SDataPacketPtr>>>& rvecPackets,
+	const std::vector<SInputInfo>& rvecInputs, std::chrono::steady_clock::time_point tNow, size_t uiMaxJobs)
+{
+	// a bundle is complete once every connected input contributed a packet, also while an input has not delivered yet
+	uint32_t uiExpectedInputs = 0;
+	for (size_t i = 0; i < rvecInputs.size(); i++)
+	{
+		if (rvecInputs[i].bConnected)
+			uiExpectedInputs |= 1u << i;
+	}
+
+	if (m_sBundleStream.uiSubscribers == 0)
+	{
+		m_BundleAssembler.Reset();								// bundles nobody subscribed to are not assembled at all
+		return;
+	}
+
+	m_BundleAssembler.SetExpectedInputs(uiExpectedInputs);
+	m_BundleAssembler.SetTolerance(static_cast<uint64_t>(m_uiBundleTolerance) * ZEROMQ_TIMESTAMP_RESOLUTION / 1000000);
+
+	std::vector<SBundle> vecBundles;
+	for (const auto& rPacket : rvecPackets)
+	{
+		m_BundleAssembler.Add(rPacket.first, rPacket.second->GetTimestamp(), rPacket.second, vecBundles);
+	}
+
+	m_uiBundlesDropped = static_cast<uint32_t>(m_BundleAssembler.GetDroppedCount() + m_uiBundlesNotEncoded);
+
+	// rate limiting and pacing apply to whole bundles
+	const EPacingMode ePacing = GetPacingMode();
+	for (size_t i = 0; i < vecBundles.size(); i++)
+	{
+		const uint64_t uiTimestamp = vecBundles[i].uiTimestamp;
+		if (uiTimestamp < m_uiLastBundleTimestamp)
+			m_uiBundleIndex = 0;
+
+		m_uiLastBundleTimestamp = uiTimestamp;
+
+		if (!SelectStream(m_sBundleStream, ePacing, i + 1 == vecBundles.size(), tNow, uiTimestamp, m_uiBundleIndex++))
+			continue;
+
+		SendEncoded(uiMaxJobs - 1);
+		SubmitBundle(std::move(vecBundles[i]), rvecInputs);
+	}
+}
+
+void CProcessorObject::UpdateEncodePool(uint32_t uiThreads)
+{
+	if (uiThreads == 0)
+	{
+		if (!m_ptrEncodePool)
+			return;
+
+		SendEncoded(0);
+		m_ptrEncodePool->RemoveQueue(m_ptrEncodeQueue);
+		m_ptrEncodeQueue.reset();
+		m_ptrEncodePool.reset();
+		return;
+	}
+
+	if (!m_ptrEncodePool)
+	{
+		m_ptrEncodePool = CEncodePool::GetShared();
+		m_ptrEncodeQueue = m_ptrEncodePool->AddQueue();
+	}
+
+	m_ptrEncodePool->Reserve(uiThreads);
+}
+
+void CProcessorObject::UpdateMulticast()
+{
+	const std::string ssTopics = m_ssMulticastTopics.Get();
+	const std::string ssInterface = m_ssMulticastInterface.Get();
+
+	if (ssTopics != m_ssAppliedMulticastTopics)
+	{
+		m_ssAppliedMulticastTopics = ssTopics;
+		ApplyMulticastTopics();
+	}
+
+#if defined(ZMQ_BUILD_DRAFT_API)
+	const bool bMulticast = !ssTopics.empty();
+	if (bMulticast == m_bRadioConnected && ssInterface == m_ssConnectedInterface)
+		return;
+
+	if (m_bRadioConnected)
+	{
+		m_RadioSock.close();
+		m_bRadioConnected = false;
+		m_ssMulticastEndpoint.Set(std::string());
+	}
+
+	m_ssConnectedInterface = ssInterface;
+	if (!bMulticast)
+		return;
+
+	// udp://[interface;]multicast-address:port, every frame is sent once, the network stack fans it out to the subscribers
+	std::string ssEndpoint = "udp://";
+	if (!ssInterface.empty())
+		ssEndpoint += ssInterface + ";";
+	ssEndpoint += std::string(ZEROMQ_RADIO_ADDRESS) + ":" + std::to_string(ZEROMQ_RADIO_START_PORT + m_iZmqChannel);
+
+	try
+	{
+		m_RadioSock = zmq::socket_t(m_ZmqCtx, zmq::socket_type::radio);
+		m_RadioSock.setsockopt(ZMQ_SNDHWM, ZEROMQ_RADIO_HWM);
+		m_RadioSock.setsockopt(ZMQ_LINGER, 0);
+		m_RadioSock.connect(ssEndpoint);
+		m_bRadioConnected = true;
+		m_ssMulticastEndpoint.Set(ssEndpoint);
+	}
+	catch (std::exception&)
+	{
+		m_RadioSock.close();
+	}
+#endif
+}
+
+void CProcessorObject::ApplyMulticastTopics()
+{
+	std::vector<std::string> vecTopics;
+	size_t uiStart = 0;
+	while (uiStart <= m_ssAppliedMulticastTopics.size())
+	{
+		size_t uiEnd = m_ssAppliedMulticastTopics.find(';', uiStart);
+		if (uiEnd == std::string::npos)
+			uiEnd = m_ssAppliedMulticastTopics.size();
+
+		// the topic is the RADIO group, longer topics can not be sent via multicast and are ignored
+		if (uiEnd > uiStart && uiEnd - uiStart <= ZEROMQ_RADIO_GROUP_MAX_LENGTH)
+			vecTopics.push_back(m_ssAppliedMulticastTopics.substr(uiStart, uiEnd - uiStart));
+
+		uiStart = uiEnd + 1;
+	}
+
+	// RADIO/DISH groups are matched exactly, unlike the topic prefixes of PUB/SUB
+	for (auto& rsStream : m_vecStreams)
+	{
+#if defined(ZMQ_BUILD_DRAFT_API)
+		rsStream.bMulticast = std::find(vecTopics.begin(), vecTopics.end(), rsStream.ssTopic) != vecTopics.end();
+#else
+		rsStream.bMulticast = false;							// libzmq draft API required
+#endif
+	}
+}
+
+uint32_t CProcessorObject::GetEncodeThreads() const
+{
+	return std::min<uint32_t>(m_uiEncodeThreads, ZEROMQ_ENCODE_THREAD_LIMIT);
+}
+
+std::unique_ptr<CProcessorObject::SEncodeJob> CProcessorObject::AcquireJob()
+{
+	std::unique_ptr<SEncodeJob> ptrJob;
+	if (m_vecFreeJobs.empty())
+	{
+		ptrJob = std::make_unique<SEncodeJob>();
+	}
+	else
+	{
+		ptrJob = std::move(m_vecFreeJobs.back());
+		m_vecFreeJobs.pop_back();
+	}
+
+	ptrJob->uiSequence = m_uiNextSequence++;
+	ptrJob->ptrPacket.reset();
+	ptrJob->sBundle = SBundle();
+	ptrJob->uiChunkThreshold = m_uiChunkThreshold;
+	ptrJob->uiChunkSize = m_uiChunkSize > 0 ? m_uiChunkSize : ZEROMQ_CHUNK_SIZE;
+	ptrJob->uiMessages = 0;
+	ptrJob->bEncoded = false;
+	ptrJob->bHead = false;
+	ptrJob->tSubmitted = std::chrono::steady_clock::now();
+	ptrJob->tEncodeBlocked = std::chrono::steady_clock::duration::zero();
+	ptrJob->tSendDuration = std::chrono::steady_clock::duration::zero();
+
+	return ptrJob;
+}
+
+void CProcessorObject::SubmitFrame(const std::shared_ptr<AvCore::SDataPacketPtr>& rptrPacket, const SInputInfo& rsInput,
+	const std::vector<const SOutputStream*>& rvecStreams)
+{
+	std::unique_ptr<SEncodeJob> ptrJob = AcquireJob();
+	SEncodeJob& rsJob = *ptrJob;
+	rsJob.ptrPacket = rptrPacket;
+	rsJob.sInput = rsInput;
+
+	// streams with the same encoding share one encoded message, so every transform is computed at most once per frame
+	for (const SOutputStream* pStream : rvecStreams)
+	{
+		size_t uiMsg = 0;
+		while (uiMsg < rsJob.uiMessages && !(rsJob.vecMessages[uiMsg].sEncoding == pStream->sEncoding))
+		{
+			uiMsg++;
+		}
+
+		if (uiMsg == rsJob.uiMessages)
+		{
+			if (rsJob.vecMessages.size() <= uiMsg)
+				rsJob.vecMessages.resize(uiMsg + 1);
+
+			SEncodedMsg& rsMsg = rsJob.vecMessages[uiMsg];
+			rsMsg.sEncoding = pStream->sEncoding;
+			rsMsg.vecTopics.clear();
+			rsMsg.vecBodies.clear();
+			rsMsg.bBundle = false;
+			rsMsg.bFailed = false;
+			rsMsg.vecRadioGroups.clear();
+			rsJob.uiMessages++;
+		}
+
+		// topics are copied, the streams may be rebuilt while the frame is in flight
+		if (pStream->uiSubscribers > 0)
+			rsJob.vecMessages[uiMsg].vecTopics.push_back(pStream->ssTopic);
+
+		if (pStream->bMulticast)
+			rsJob.vecMessages[uiMsg].vecRadioGroups.push_back(pStream->ssTopic);
+	}
+
+	StartJob(std::move(ptrJob));
+}
+
+void CProcessorObject::SubmitBundle(SBundle&& rrsBundle, const std::vector<SInputInfo>& rvecInputs)
+{
+	std::unique_ptr<SEncodeJob> ptrJob = AcquireJob();
+	SEncodeJob& rsJob = *ptrJob;
+	rsJob.sBundle = std::move(rrsBundle);
+	rsJob.vecBundleInputs = rvecInputs;
+
+	if (rsJob.vecMessages.empty())
+		rsJob.vecMessages.resize(1);
+
+	SEncodedMsg& rsMsg = rsJob.vecMessages[0];
+	rsMsg.sEncoding = m_sBundleStream.sEncoding;
+	rsMsg.vecTopics.assign(1, m_sBundleStream.ssTopic);
+	rsMsg.vecBodies.clear();
+	rsMsg.bBundle = true;
+	rsMsg.bFailed = false;
+	rsMsg.vecRadioGroups.clear();
+	rsJob.uiMessages = 1;
+
+	StartJob(std::move(ptrJob));
+}
+
+void CProcessorObject::StartJob(std::unique_ptr<SEncodeJob> ptrJob)
+{
+	SEncodeJob* pJob = ptrJob.get();
+
+	if (!m_ptrEncodePool)
+	{
+		// encoded on the send thread: the frame is the only one in flight, every part is sent as soon as it is packed
+		SendEncoded(0);
+		m_dequeJobs.push_back(std::move(ptrJob));
+
+		EncodeJob(*pJob, [this, pJob](SEncodedPart&& rrsPart)
+		{
+			const auto tStart = std::chrono::steady_clock::now();
+			SendPart(*pJob, rrsPart);
+			pJob->tEncodeBlocked += std::chrono::steady_clock::now() - tStart;
+		});
+		pJob->bEncoded = true;
+		return;
+	}
+
+	m_dequeJobs.push_back(std::move(ptrJob));
+
+	m_ptrEncodePool->Push(*m_ptrEncodeQueue, [this, pJob]
+	{
+		// only the frame the send stage is sending waits for it, so a stalled channel blocks at most one worker
+		// of the shared pool; the parts of later frames are buffered until their turn
+		EncodeJob(*pJob, [this, pJob](SEncodedPart&& rrsPart)
+		{
+			const auto tStart = std::chrono::steady_clock::now();
+			std::unique_lock<std::mutex> lock(m_mtxPacketQueue);
+			m_cvPartSpace.wait(lock, [pJob] { return !pJob->bHead || pJob->dequeParts.size() < ZEROMQ_ENCODE_PART_LIMIT; });
+			pJob->dequeParts.push_back(std::move(rrsPart));
+			pJob->tEncodeBlocked += std::chrono::steady_clock::now() - tStart;
+			m_cvPacketQueue.notify_all();
+		});
+
+		// notify under the lock, the object may be gone as soon as the send thread saw the flag
+		std::unique_lock<std::mutex> lock(m_mtxPacketQueue);
+		pJob->bEncoded = true;
+		m_cvPacketQueue.notify_all();
+	});
+}
+
+void CProcessorObject::EncodeJob(SEncodeJob& rsJob, const TPartSink& fnSink)
+{
+	rsJob.tEncodeStart = std::chrono::steady_clock::now();
+
+	if (!rsJob.ptrPacket)
+	{
+		EncodeBundle(rsJob);
+		rsJob.tEncodeEnd = std::chrono::steady_clock::now();
+		return;
+	}
+
+	const AvCore::SDataPacketPtr& rFrame = *rsJob.ptrPacket;
+	for (size_t i = 0; i < rsJob.uiMessages; i++)
+	{
+		SEncodedMsg& rsMsg = rsJob.vecMessages[i];
+
+		SPayload sPayload;
+		if (!PreparePayload(rFrame, rsJob.sInput, rsMsg.sEncoding, rsJob.vecTransformBuffer, sPayload))
+			continue;
+
+		if (rsJob.uiChunkThreshold > 0 && sPayload.uiNumBytes > rsJob.uiChunkThreshold)
+		{
+			BuildChunks(rFrame, sPayload, rsJob.uiChunkSize, rsJob.msgBuffer, i, fnSink);
+			continue;
+		}
+
+		BuildMsgBuffer(rFrame, sPayload, rsJob.msgBuffer);
+		SEncodedPart sPart;
+		sPart.uiMsg = i;
+		sPart.msgBody = zmq::message_t(rsJob.msgBuffer.data(), rsJob.msgBuffer.size());
+		rsJob.msgBuffer.clear();
+		fnSink(std::move(sPart));
+	}
+
+	rsJob.tEncodeEnd = std::chrono::steady_clock::now();
+}
+
+void CProcessorObject::EncodeBundle(SEncodeJob& rsJob)
+{
+	SEncodedMsg& rsMsg = rsJob.vecMessages[0];
+	const SBundle& rsBundle = rsJob.sBundle;
+
+	// one part per input, every part is a complete forwarding message with the input name as source
+	for (size_t uiInput = 0; uiInput < rsBundle.vecPackets.size(); uiInput++)
+	{
+		if (!rsBundle.vecPackets[uiInput])
+			continue;
+
+		const SInputInfo& rsInput = rsJob.vecBundleInputs[uiInput];
+
+		SPayload sPayload;
+		sPayload.ssSource = rsInput.ssName.empty() ? "bundle" + std::to_string(uiInput) : rsInput.ssName;
+		if (!PreparePayload(*rsBundle.vecPackets[uiInput], rsInput, rsMsg.sEncoding, rsJob.vecTransformBuffer, sPayload))
+		{
+			rsMsg.vecBodies.clear();								// bundles are only forwarded as a consistent set
+			rsMsg.bFailed = true;
+			return;
+		}
+
+		BuildMsgBuffer(*rsBundle.vecPackets[uiInput], sPayload, rsJob.msgBuffer);
+		rsMsg.vecBodies.emplace_back(rsJob.msgBuffer.data(), rsJob.msgBuffer.size());
+		rsJob.msgBuffer.clear();
+	}
+}
+
+void CProcessorObject::SendEncoded(size_t uiMaxPending)
+{
+	while (!m_dequeJobs.empty())
+	{
+		SEncodeJob& rsJob = *m_dequeJobs.front();
+
+		// the encode threads always finish their tasks, so waiting is bounded by the encode time
+		if (!SendParts(rsJob, m_dequeJobs.size() > uiMaxPending))
+			return;
+
+		SendJob(rsJob);
+
+		rsJob.ptrPacket.reset();
+		rsJob.sBundle = SBundle();
+		m_vecFreeJobs.push_back(std::move(m_dequeJobs.front()));
+		m_dequeJobs.pop_front();
+	}
+}
+
+bool CProcessorObject::SendParts(SEncodeJob& rsJob, bool bWait)
+{
+	std::unique_lock<std::mutex> lock(m_mtxPacketQueue);
+	if (!rsJob.bHead)
+	{
+		rsJob.bHead = true;
+		rsJob.tHead = std::chrono::steady_clock::now();
+	}
+
+	while (true)
+	{
+		if (bWait)
+			m_cvPacketQueue.wait(lock, [&rsJob] { return rsJob.bEncoded || !rsJob.dequeParts.empty(); });
+
+		if (rsJob.dequeParts.empty())
+			return rsJob.bEncoded;
+
+		SEncodedPart sPart = std::move(rsJob.dequeParts.front());
+		rsJob.dequeParts.pop_front();
+
+		// send without the lock, the encode stage packs the next part meanwhile
+		lock.unlock();
+		m_cvPartSpace.notify_all();
+		SendPart(rsJob, sPart);
+		lock.lock();
+	}
+}
+
+void CProcessorObject::SendPart(SEncodeJob& rsJob, SEncodedPart& rsPart)
+{
+	const auto tSendStart = std::chrono::steady_clock::now();
+	if (!rsJob.bHead)
+	{
+		rsJob.bHead = true;
+		rsJob.tHead = tSendStart;
+	}
+
+	SEncodedMsg& rsMsg = rsJob.vecMessages[rsPart.uiMsg];
+	if (rsPart.bChunk)
+	{
+		// a dropped chunk invalidates the whole frame, the remaining chunks are not sent
+		if (!rsMsg.bFailed)
+			rsMsg.bFailed = !SendChunk(rsMsg, rsPart.msgBody);
+	}
+	else
+	{
+		for (const std::string& rssTopic : rsMsg.vecTopics)
+		{
+			if (m_bNoDrop)
+				SendNoDrop(rssTopic, rsPart.msgBody, true);
+			else
+				SendMsgBuffer(rssTopic, rsPart.msgBody);
+		}
+	}
+
+	// chunks are sent as separate multicast messages, the same way as over tcp
+	for (const std::string& rssGroup : rsMsg.vecRadioGroups)
+	{
+		SendRadio(rssGroup, rsPart.msgBody);
+	}
+
+	rsJob.tSendDuration += std::chrono::steady_clock::now() - tSendStart;
+}
+
+void CProcessorObject::SendJob(SEncodeJob& rsJob)
+{
+	const auto tSendStart = std::chrono::steady_clock::now();
+
+	for (size_t i = 0; i < rsJob.uiMessages; i++)
+	{
+		SEncodedMsg& rsMsg = rsJob.vecMessages[i];
+		if (rsMsg.bBundle && rsMsg.bFailed)
+		{
+			m_uiBundlesNotEncoded++;
+			m_uiBundlesDropped = static_cast<uint32_t>(m_BundleAssembler.GetDroppedCount() + m_uiBundlesNotEncoded);
+		}
+		else if (rsMsg.bBundle && !rsMsg.vecBodies.empty())
+		{
+			SendBundle(rsMsg);
+		}
+
+		rsMsg.vecBodies.clear();
+	}
+
+	rsJob.tSendDuration += std::chrono::steady_clock::now() - tSendStart;
+
+	// per stage timing as moving average over ~16 frames
+	const auto fnAverage = [](uint32_t& ruiAverage, std::chrono::steady_clock::duration tDuration)
+	{
+		const int64_t iSample = std::max<int64_t>(0, std::chrono::duration_cast<std::chrono::microseconds>(tDuration).count());
+		ruiAverage = static_cast<uint32_t>(static_cast<int64_t>(ruiAverage) + (iSample - static_cast<int64_t>(ruiAverage)) / 16);
+	};
+
+	// encoding and sending overlap, the time the encode stage waited for the send stage is not encode time
+	fnAverage(m_uiPoolWaitTime, rsJob.tEncodeStart - rsJob.tSubmitted);
+	fnAverage(m_uiEncodeTime, rsJob.tEncodeEnd - rsJob.tEncodeStart - rsJob.tEncodeBlocked);
+	fnAverage(m_uiReorderTime, rsJob.tHead - rsJob.tEncodeEnd);
+	fnAverage(m_uiSendTime, rsJob.tSendDuration);
+}
+
+bool CProcessorObject::PreparePayload(const AvCore::SDataPacketPtr& rFrame, const SInputInfo& rsInput, const SEncoding& rsEncoding,
+	std::vector<uint8_t>& rvecTransformBuffer, SPayload& rsPayload)
+{
+	if (!rsEncoding.bPayload)										// METADATA_ONLY
+	{
+		rsPayload.ssType = "metadata_only";
+	}
+	else if (rsEncoding.bTransform && !rsInput.bIsRGBA)
+	{
+		return false;  // transforms are only available for RGBA inputs, also RGBA at full resolution
+	}
+	else if (rsEncoding.bTransform && !rsEncoding.sTransform.IsIdentity())	// TRANSFORMED RGBA
+	{
+		if (rsInput.uiWidth * rsInput.uiHeight * 4 != rFrame.GetDataLen())
+			return false;  // invalid package size for type
+
+		if (rsInput.uiWidth < rsEncoding.sTransform.uiScale || rsInput.uiHeight < rsEncoding.sTransform.uiScale)
+			return false;  // nothing left after downscaling
+
+		uint32_t uiWidth = 0;
+		uint32_t uiHeight = 0;
+		TransformRGBA(rsEncoding.sTransform, static_cast<const uint8_t*>(rFrame.GetData()), rsInput.uiWidth, rsInput.uiHeight,
+			rvecTransformBuffer, uiWidth, uiHeight);
+
+		rsPayload.uiNumBytes = static_cast<uint32_t>(rvecTransformBuffer.size());
+		rsPayload.pData = reinterpret_cast<const char*>(rvecTransformBuffer.data());
+		rsPayload.ssType = "image";
+		rsPayload.ssFormat = GetPayloadFormatName(rsEncoding.sTransform.eFormat);
+		rsPayload.aFormatSize[0] = uiWidth;
+		rsPayload.aFormatSize[1] = uiHeight;
+		rsPayload.aFormatSize[2] = GetPayloadFormatBPP(rsEncoding.sTransform.eFormat);
+	}
+	else if (rsInput.bIsRGBA)										// RGBA, also the RGBA transform at full resolution
+	{
+		rsPayload.uiNumBytes = rsInput.uiWidth * rsInput.uiHeight * 4;
+
+		if (rsPayload.uiNumBytes != rFrame.GetDataLen())
+			return false;  // invalid package size for type
+
+		rsPayload.pData = static_cast<const char*>(rFrame.GetData());
+		rsPayload.ssType = "image";
+		rsPayload.ssFormat = "RGBA";
+		rsPayload.aFormatSize[0] = rsInput.uiWidth;
+		rsPayload.aFormatSize[1] = rsInput.uiHeight;
+		rsPayload.aFormatSize[2] = 32;
+	}
+	else															// RAW / OTHER
+	{
+		rsPayload.uiNumBytes = rFrame.GetDataLen();
+		rsPayload.pData = static_cast<const char*>(rFrame.GetData());
+		rsPayload.ssFormat = rsInput.ssName;
+		rsPayload.aFormatSize[0] = rsInput.uiWidth;
+		rsPayload.aFormatSize[1] = rsInput.uiHeight;
+		rsPayload.aFormatSize[2] = rsInput.uiBPP;
+	}
+
+	return true;
+}
+
+void CProcessorObject::BuildMsgBuffer(const AvCore::SDataPacketPtr& rFrame, const SPayload& rsPayload, msgpack::sbuffer& rMsgBuffer)
+{
+	msgpack::packer<msgpack::sbuffer> packer(&rMsgBuffer);
+	packer.pack(rsPayload.ssSource);
+	packer.pack(rFrame.GetTimestamp());
+	packer.pack(rsPayload.ssType);
+	packer.pack(rsPayload.ssFormat);
+	packer.pack(rsPayload.aFormatSize);
+	packer.pack_bin(rsPayload.uiNumBytes);
+	if (rsPayload.uiNumBytes > 0)
+	{
+		packer.pack_bin_body(rsPayload.pData, rsPayload.uiNumBytes);
+	}
+}
+
+void CProcessorObject::SendMsgBuffer(const std::string& topicStr, zmq::message_t& msgBody)
 {
-	const std::string topicStr = ZEROMQ_TOPIC;
 	zmq::message_t topic(topicStr.length());
-	zmq::message_t msg(m_MsgBuffer.size());
+	zmq::message_t msg;
 
 	memcpy(topic.data(), topicStr.data(), topicStr.size());
-	memcpy(msg.data(), m_MsgBuffer.data(), m_MsgBuffer.size());
+	msg.copy(msgBody);												// shares the body data, no copy
 
 	m_ZmqSock.send(topic, ZMQ_SNDMORE);
 	m_ZmqSock.send(msg);
+}
+
+void CProcessorObject::BuildChunks(const AvCore::SDataPacketPtr& rFrame, const SPayload& rsPayload, uint32_t uiChunkSize,
+	msgpack::sbuffer& rMsgBuffer, size_t uiMsg, const TPartSink& fnSink)
+{
+	const std::string ssType = rsPayload.ssType + ZEROMQ_CHUNK_SUFFIX;
+	const uint64_t uiChunkCount = (static_cast<uint64_t>(rsPayload.uiNumBytes) + uiChunkSize - 1) / uiChunkSize;
+
+	for (uint64_t uiChunk = 0; uiChunk < uiChunkCount; uiChunk++)
+	{
+		const uint64_t uiOffset = uiChunk * uiChunkSize;
+		const uint32_t uiNumBytes = static_cast<uint32_t>(std::min<uint64_t>(uiChunkSize, rsPayload.uiNumBytes - uiOffset));
+		const std::array<uint64_t, 4> aChunk{ { uiOffset, rsPayload.uiNumBytes, uiChunk, uiChunkCount } };
+
+		msgpack::packer<msgpack::sbuffer> packer(&rMsgBuffer);
+		packer.pack(rsPayload.ssSource);
+		packer.pack(rFrame.GetTimestamp());
+		packer.pack(ssType);
+		packer.pack(rsPayload.ssFormat);
+		packer.pack(rsPayload.aFormatSize);
+		packer.pack(aChunk);
+		packer.pack_bin(uiNumBytes);
+
+		// header and chunk data go directly into the message, the chunk is sent while the next one is packed
+		SEncodedPart sPart;
+		sPart.uiMsg = uiMsg;
+		sPart.bChunk = true;
+		sPart.msgBody = zmq::message_t(rMsgBuffer.size() + uiNumBytes);
+		memcpy(sPart.msgBody.data(), rMsgBuffer.data(), rMsgBuffer.size());
+		memcpy(static_cast<char*>(sPart.msgBody.data()) + rMsgBuffer.size(), rsPayload.pData + uiOffset, uiNumBytes);
+		rMsgBuffer.clear();
+
+		fnSink(std::move(sPart));
+	}
+}
+
+bool CProcessorObject::SendChunk(const SEncodedMsg& rsMsg, zmq::message_t& msgBody)
+{
+	// a dropped chunk invalidates the whole frame, so wait for the subscribers instead of dropping
+	const bool bWaitForever = m_bNoDrop;
+	SetNoDrop(true);
+
+	bool bSent = true;
+	for (const std::string& rssTopic : rsMsg.vecTopics)
+	{
+		bSent = bSent && SendNoDrop(rssTopic, msgBody, bWaitForever);
+	}
+
+	SetNoDrop(bWaitForever);
+
+	return bSent;
+}
+
+bool CProcessorObject::SendBundle(SEncodedMsg& rsMsg)
+{
+	// the parts of a multipart message are delivered all or none, subscribers always get the complete bundle
+	for (const std::string& rssTopic : rsMsg.vecTopics)
+	{
+		zmq::message_t topic(rssTopic.data(), rssTopic.size());
+		while (!m_ZmqSock.send(topic, zmq::send_flags::sndmore))
+		{
+			if (!m_bZeroMQActive)
+				return false;  // only fails in no drop mode while a subscriber does not keep up
+		}
 
-	m_MsgBuffer.clear();
+		for (size_t i = 0; i < rsMsg.vecBodies.size(); i++)
+		{
+			zmq::message_t msg;
+			msg.copy(rsMsg.vecBodies[i]);
+			m_ZmqSock.send(msg, i + 1 < rsMsg.vecBodies.size() ? zmq::send_flags::sndmore : zmq::send_flags::none);
+		}
+	}
+
+	return true;
+}
+
+bool CProcessorObject::SendNoDrop(const std::string& topicStr, zmq::message_t& msgBody, bool bWaitForever)
+{
+	// with ZMQ_XPUB_NODROP a send blocks while a subscriber queue is full, ZMQ_SNDTIMEO bounds every attempt
+	const auto tTimeout = std::chrono::steady_clock::now() + ZEROMQ_CHUNK_SEND_TIMEOUT;
+
+	while (m_bZeroMQActive)
+	{
+		zmq::message_t topic(topicStr.data(), topicStr.size());
+		if (m_ZmqSock.send(topic, zmq::send_flags::sndmore))
+		{
+			zmq::message_t msg;
+			msg.copy(msgBody);
+			m_ZmqSock.send(msg, zmq::send_flags::none);
+			return true;
+		}
+
+		if (!bWaitForever && std::chrono::steady_clock::now() > tTimeout)
+			return false;  // a subscriber does not keep up, give up this message
+	}
+
+	return false;
+}
+
+void CProcessorObject::SetNoDrop(bool bNoDrop)
+{
+	if (m_bNoDrop == bNoDrop)
+		return;
+
+	m_ZmqSock.setsockopt(ZMQ_XPUB_NODROP, bNoDrop ? 1 : 0);
+	m_bNoDrop = bNoDrop;
+}
+
+void CProcessorObject::SendRadio(const std::string& ssGroup, const zmq::message_t& msgBody)
+{
+#if defined(ZMQ_BUILD_DRAFT_API)
+	if (!m_bRadioConnected)
+		return;
+
+	// fragment header (little endian): sequence (uint32), fragment index (uint16), fragment count (uint16),
+	// total size (uint32), fragment offset (uint32); a datagram also carries the group and its length byte
+	const size_t uiFragmentSize = ZEROMQ_RADIO_DATAGRAM_SIZE - 1 - ssGroup.size() - ZEROMQ_RADIO_HEADER_SIZE;
+	const size_t uiTotalSize = msgBody.size();
+	const size_t uiFragments = std::max<size_t>(1, (uiTotalSize + uiFragmentSize - 1) / uiFragmentSize);
+	if (uiFragments > UINT16_MAX || uiTotalSize > UINT32_MAX)
+		return;  // too large for the fragment header, use chunking
+
+	const uint32_t uiSequence = m_mapRadioSequence[ssGroup]++;
+	const uint8_t* pBody = static_cast<const uint8_t*>(msgBody.data());
+
+	try
+	{
+		for (size_t uiFragment = 0; uiFragment < uiFragments; uiFragment++)
+		{
+			const size_t uiOffset = uiFragment * uiFragmentSize;
+			const size_t uiNumBytes = std::min(uiFragmentSize, uiTotalSize - uiOffset);
+
+			zmq::message_t msg(ZEROMQ_RADIO_HEADER_SIZE + uiNumBytes);
+			uint8_t* pData = static_cast<uint8_t*>(msg.data());
+			WriteLE32(pData, uiSequence);
+			WriteLE16(pData + 4, static_cast<uint16_t>(uiFragment));
+			WriteLE16(pData + 6, static_cast<uint16_t>(uiFragments));
+			WriteLE32(pData + 8, static_cast<uint32_t>(uiTotalSize));
+			WriteLE32(pData + 12, static_cast<uint32_t>(uiOffset));
+			if (uiNumBytes > 0)
+				memcpy(pData + ZEROMQ_RADIO_HEADER_SIZE, pBody + uiOffset, uiNumBytes);
+
+			msg.set_group(ssGroup.c_str());
+			m_RadioSock.send(msg, zmq::send_flags::dontwait);	// lost fragments are accounted for by the receivers
+		}
+	}
+	catch (zmq::error_t&)
+	{
+		// multicast is best effort, a failing RADIO socket must not stop the tcp forwarding
+	}
+#else
+	(void)ssGroup;
+	(void)msgBody;
+#endif
 }
 
 void CProcessorObject::OnConnect(const AVETO::Core::SConnectionEvent& rsConnectInfo)
 {
-	HandleConnectorChange(rsConnectInfo.tOutConnectorID);
+	HandleConnectorChange(AvCore::GetProp<std::string>(rsConnectInfo.tInConnectorID, "Name"), rsConnectInfo.tOutConnectorID);
 }
 
 void CProcessorObject::OnConnectedConnectorChanged(const char* szOwnConnectorName, uint32_t uiOwnConnectorFlags, AVETO::Core::TObjID tConnectedConnectorID)
@@ -208,7 +1156,7 @@ void CProcessorObject::OnConnectedConnectorChanged(const char* szOwnConnectorNam
 		return;
 	}
 
-	HandleConnectorChange(tConnectedConnectorID);	
+	HandleConnectorChange(szOwnConnectorName ? szOwnConnectorName : "", tConnectedConnectorID);
 }
 
 void CProcessorObject::ProcessData(const AVETO::Core::SDataPacket* rgsPackets, uint32_t uiPackets)
@@ -216,30 +1164,102 @@ void CProcessorObject::ProcessData(const AVETO::Core::SDataPacket* rgsPackets, u
 	if (!uiPackets) return;
 	if (!rgsPackets) return;
 
-	// lock
-	std::unique_lock<std::mutex> lock(m_mtxPacketQueue);
+	std::shared_ptr<AvCore::SDataPacketPtr> ptrRgsPacket(new AvCore::SDataPacketPtr());
+	ptrRgsPacket->Set(*rgsPackets);
+
+	{ // lock
+		std::unique_lock<std::mutex> lock(m_mtxPacketQueue);
+
+		if (GetPacingMode() != EPacingMode::WallClock)
+		{
+			// replay pacing is lossless: hold back the source until the forwarding caught up
+			m_cvQueueSpace.wait(lock, [this] { return m_queuePackets.size() < ZEROMQ_QUEUE_LIMIT || !m_bZeroMQActive; });
+		}
+
+		// drop the oldest packets if the forwarding can not keep up
+		while (m_queuePackets.size() >= ZEROMQ_QUEUE_LIMIT)
+		{
+			m_queuePackets.pop();
+		}
+
+		m_queuePackets.push(ptrRgsPacket);
+	}
+
+	m_cvPacketQueue.notify_one();
+}
+
+void CProcessorObject::ProcessBundleData0(const AVETO::Core::SDataPacket* rgsPackets, uint32_t uiPackets)
+{
+	ProcessBundleData(0, rgsPackets, uiPackets);
+}
+
+void CProcessorObject::ProcessBundleData1(const AVETO::Core::SDataPacket* rgsPackets, uint32_t uiPackets)
+{
+	ProcessBundleData(1, rgsPackets, uiPackets);
+}
+
+void CProcessorObject::ProcessBundleData2(const AVETO::Core::SDataPacket* rgsPackets, uint32_t uiPackets)
+{
+	ProcessBundleData(2, rgsPackets, uiPackets);
+}
+
+void CProcessorObject::ProcessBundleData3(const AVETO::Core::SDataPacket* rgsPackets, uint32_t uiPackets)
+{
+	ProcessBundleData(3, rgsPackets, uiPackets);
+}
+
+void CProcessorObject::ProcessBundleData(size_t uiInput, const AVETO::Core::SDataPacket* rgsPackets, uint32_t uiPackets)
+{
+	if (!uiPackets) return;
+	if (!rgsPackets) return;
 
 	std::shared_ptr<AvCore::SDataPacketPtr> ptrRgsPacket(new AvCore::SDataPacketPtr());
 	ptrRgsPacket->Set(*rgsPackets);
 
-	m_queuePackets.push(ptrRgsPacket);
+	const size_t uiQueueLimit = ZEROMQ_QUEUE_LIMIT * ZEROMQ_BUNDLE_INPUTS;
+
+	{ // lock
+		std::unique_lock<std::mutex> lock(m_mtxPacketQueue);
+
+		if (GetPacingMode() != EPacingMode::WallClock)
+		{
+			// replay pacing is lossless: hold back the source until the forwarding caught up
+			m_cvQueueSpace.wait(lock, [this, uiQueueLimit] { return m_queueBundlePackets.size() < uiQueueLimit || !m_bZeroMQActive; });
+		}
+
+		// drop the oldest packets if the forwarding can not keep up, the bundles missing them are dropped as a whole
+		while (m_queueBundlePackets.size() >= uiQueueLimit)
+		{
+			m_queueBundlePackets.pop();
+		}
+
+		m_queueBundlePackets.emplace(uiInput, ptrRgsPacket);
+	}
+
+	m_cvPacketQueue.notify_one();
 }
 
-void CProcessorObject::HandleConnectorChange(AVETO::Core::TObjID tConnectedConnectorID)
+void CProcessorObject::HandleConnectorChange(const std::string& ssOwnConnectorName, AVETO::Core::TObjID tConnectedConnectorID)
 {
 	// lock to prevent handling queue packages incorrectly
 	std::unique_lock<std::mutex> lock(m_mtxPacketQueue);
 
-	m_ssInputName = AvCore::GetProp<std::string>(tConnectedConnectorID, "Alias");
-	if (m_ssInputName.empty())
+	for (size_t i = 0; i < m_vecBundleInputs.size(); i++)
 	{
-		m_ssInputName = AvCore::GetProp<std::string>(tConnectedConnectorID, "Name");		
+		if (ssOwnConnectorName != ZEROMQ_BUNDLE_CONNECTOR + std::to_string(i))
+			continue;
+
+		ReadInputInfo(tConnectedConnectorID, m_vecBundleInputs[i]);
+
+		// clear bundle packet queue
+		while (m_queueBundlePackets.size() > 0)
+		{
+			m_queueBundlePackets.pop();
+		}
+		return;
 	}
 
-	m_uiInputWidth = AvCore::GetProp<uint32_t>(tConnectedConnectorID, "Width");
-	m_uiInputHeight = AvCore::GetProp<uint32_t>(tConnectedConnectorID, "Height");
-	m_uiInputBPP = AvCore::GetProp<uint32_t>(tConnectedConnectorID, "BPP");
-	m_bInputIsRGBA = IsValidRGBA(tConnectedConnectorID);
+	ReadInputInfo(tConnectedConnectorID, m_sInput);
 	
 	// clear packet queue
 	while (m_queuePackets.size() > 0)
@@ -248,6 +1268,21 @@ void CProcessorObject::HandleConnectorChange(AVETO::Core::TObjID tConnectedConne
 	}
 }
 
+void CProcessorObject::ReadInputInfo(AVETO::Core::TObjID tConnectedConnectorID, SInputInfo& rsInput) const
+{
+	rsInput.bConnected = tConnectedConnectorID != 0;
+	rsInput.ssName = AvCore::GetProp<std::string>(tConnectedConnectorID, "Alias");
+	if (rsInput.ssName.empty())
+	{
+		rsInput.ssName = AvCore::GetProp<std::string>(tConnectedConnectorID, "Name");		
+	}
+
+	rsInput.uiWidth = AvCore::GetProp<uint32_t>(tConnectedConnectorID, "Width");
+	rsInput.uiHeight = AvCore::GetProp<uint32_t>(tConnectedConnectorID, "Height");
+	rsInput.uiBPP = AvCore::GetProp<uint32_t>(tConnectedConnectorID, "BPP");
+	rsInput.bIsRGBA = IsValidRGBA(tConnectedConnectorID);
+}
+
 bool CProcessorObject::IsValidRGBA(AVETO::Core::TObjID tConnectedConnectorID) const
 {
 	const uint8_t uiFormatStandard =
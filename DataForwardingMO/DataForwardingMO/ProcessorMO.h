@@ -4,7 +4,7 @@
 * \verbatim
 ******************************************************************************
 *                                                                            *
-*    Copyright (c) 2015-2022, b-plus technologies GmbH.                      *
+*    Copyright (c) 2015-2026, b-plus technologies GmbH.                      *
 *                                                                            *
 *    All rights are reserved by b-plus technologies GmbH.                    *
 *    The Customer is entitled to modify this software under his              *
@@ -19,9 +19,9 @@
 *
 * \brief Data Forwarding MO
 * \author Christopher Maneth
-* \copyright (C)2015-2022 b-plus technologies GmbH
-* \date 04.05.2022
-* \version 2.4
+* \copyright (C)2015-2026 b-plus technologies GmbH
+* \date 19.10.2026
+* \version 2.5
 *
 ******************************************************************************/
 
@@ -38,8 +38,8 @@
 #define VERSIONINFO_COMMENTS            ""
 
 // Version information
-#define VERSIONINFO_VERSION             2.4
-#define VERSIONINFO_BUILD               240
+#define VERSIONINFO_VERSION             2.5
+#define VERSIONINFO_BUILD               250
 #define VERSIONINFO_SUBBUILD            0
 
 // ZMQ configuration
@@ -47,7 +47,32 @@
 #define ZEROMQ_START_PORT				(5770)
 #define ZEROMQ_CHANNEL_LIMIT			(20)
 #define ZEROMQ_TOPIC					"out/image0"
+#define ZEROMQ_TOPIC_RGB				"variant/image0/rgb"
+#define ZEROMQ_TOPIC_HALF				"variant/image0/half"
+#define ZEROMQ_TOPIC_QUARTER			"variant/image0/quarter"
+#define ZEROMQ_TOPIC_PROFILE			"profile/"
+#define ZEROMQ_TOPIC_BUNDLE				"bundle/sync"
 #define ZEROMQ_SOURCE					"image0"
+#define ZEROMQ_PROFILE_LIMIT			(8)
+#define ZEROMQ_QUEUE_LIMIT				(8)
+#define ZEROMQ_CHUNK_SUFFIX				"_chunk"
+#define ZEROMQ_CHUNK_SIZE				(1024 * 1024)
+#define ZEROMQ_CHUNK_SEND_TIMEOUT		(std::chrono::milliseconds(1000))
+#define ZEROMQ_SEND_TIMEOUT_MS			(100)
+#define ZEROMQ_TIMESTAMP_RESOLUTION		(1000000000ULL)				// AVETO packet timestamp ticks per second (ns)
+#define ZEROMQ_ENCODE_THREAD_LIMIT		(32)
+#define ZEROMQ_ENCODE_JOBS_PER_THREAD	(2)							// frames in flight per encode thread
+#define ZEROMQ_ENCODE_PART_LIMIT		(4)							// encoded messages / chunks of the sending frame waiting for the send thread
+#define ZEROMQ_BUNDLE_CONNECTOR			"Bundle Input "
+#define ZEROMQ_BUNDLE_INPUTS			(4)
+#define ZEROMQ_BUNDLE_OPEN_LIMIT		(16)						// incomplete bundles
+#define ZEROMQ_RADIO_ADDRESS			"239.0.0.1"
+#define ZEROMQ_RADIO_INTERFACE			"127.0.0.1"
+#define ZEROMQ_RADIO_START_PORT			(5970)
+#define ZEROMQ_RADIO_DATAGRAM_SIZE		(8192)						// libzmq UDP datagram limit, including the group
+#define ZEROMQ_RADIO_HEADER_SIZE		(16)						// fragment header
+#define ZEROMQ_RADIO_HWM				(65536)						// fragments
+#define ZEROMQ_RADIO_GROUP_MAX_LENGTH	(255)						// ZMQ_GROUP_MAX_LENGTH of libzmq >= 4.3
 
 #if defined(_MSC_VER)
 #	define NOMINMAX
@@ -57,14 +82,26 @@
 #include <Core/AvCore.h>
 #include <Dev/Support/AvProcessorObj.h>
 
+#include <algorithm>
 #include <iostream>
 #include <chrono>
 #include <thread>
 #include <queue>
+#include <map>
+#include <deque>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <vector>
 #include <msgpack.hpp>
 #include <zmq.hpp>
 #include <zmq_addon.hpp>
 
+#include "PayloadTransform.h"
+#include "ForwardingProfile.h"
+#include "EncodePool.h"
+#include "BundleAssembler.h"
+#include "SharedString.h"
 
 class CProcessorObject : public AVETO::Dev::Support::CAvetoProcessorObject
 {
@@ -79,6 +116,10 @@ public:
 	// Connector map
 	BEGIN_AVETO_CONNECTOR_MAP()
 		AVETO_CONNECTOR_CYCLE_INPUT_FIRE_AND_FORGET("*", "Input Raw", ProcessData)
+		AVETO_CONNECTOR_CYCLE_INPUT_FIRE_AND_FORGET("*", ZEROMQ_BUNDLE_CONNECTOR "0", ProcessBundleData0)
+		AVETO_CONNECTOR_CYCLE_INPUT_FIRE_AND_FORGET("*", ZEROMQ_BUNDLE_CONNECTOR "1", ProcessBundleData1)
+		AVETO_CONNECTOR_CYCLE_INPUT_FIRE_AND_FORGET("*", ZEROMQ_BUNDLE_CONNECTOR "2", ProcessBundleData2)
+		AVETO_CONNECTOR_CYCLE_INPUT_FIRE_AND_FORGET("*", ZEROMQ_BUNDLE_CONNECTOR "3", ProcessBundleData3)
 	END_AVETO_CONNECTOR_MAP()
 
 	// Interface map
@@ -91,9 +132,34 @@ public:
 		AVETO_PROPERTY_CHAIN_BASE(AVETO::Dev::Support::CAvetoProcessorObject)
 		AVETO_PROPERTY_ENTRY(m_uiFPSLimit, "FPS Limit", "The fps rate used for forwarding")
 		AVETO_PROPERTY_ENTRY(m_bNoPayload, "No Payload", "If set only metadata will be sent")
+		AVETO_PROPERTY_ENTRY(m_uiPacingMode, "Pacing Mode", "0: wall clock, 1: packet timestamps (1/FPS of data time), 2: every Nth packet")
+		AVETO_PROPERTY_ENTRY(m_uiDecimation, "Decimation", "N for pacing mode 2 (every Nth packet is forwarded, profiles scale N by FPS Limit / fps)")
+		AVETO_PROPERTY_ENTRY(m_ssProfiles, "Profiles", "Additional outputs: name:fps:format:scale:payload;...")
+		AVETO_PROPERTY_ENTRY(m_uiChunkThreshold, "Chunk Threshold", "Payloads larger than this (bytes) are sent in chunks, 0 = off")
+		AVETO_PROPERTY_ENTRY(m_uiChunkSize, "Chunk Size", "The chunk size in bytes used for large payloads")
+		AVETO_PROPERTY_ENTRY(m_uiBundleTolerance, "Bundle Tolerance", "Maximum timestamp difference [us] of the packets of a bundle")
+#if defined(ZMQ_BUILD_DRAFT_API)
+		AVETO_PROPERTY_ENTRY(m_ssMulticastTopics, "Multicast Topics", "Topics which are additionally sent once via UDP multicast (RADIO/DISH): topic;topic;...")
+		AVETO_PROPERTY_ENTRY(m_ssMulticastInterface, "Multicast Interface", "Address of the network interface used for multicast")
+#endif
+		AVETO_PROPERTY_ENTRY(m_uiEncodeThreads, "Encode Threads", "Size of the encode pool shared by all forwarding channels, 0 = encode on the send thread")
 		AVETO_PROPERTY_SET_READONLY_FLAG()
 		AVETO_PROPERTY_ENTRY(m_iZmqChannel, "Forward Channel", "The channel used for forwarding")
 		AVETO_PROPERTY_ENTRY(m_iZmqPort, "Forward Port", "The tcp port used for forwarding")
+		AVETO_PROPERTY_ENTRY(m_uiSubscribers, "Subscribers", "Number of subscribers of the " ZEROMQ_TOPIC " topic")
+		AVETO_PROPERTY_ENTRY(m_uiSubscribersRGB, "Subscribers RGB", "Number of subscribers of the " ZEROMQ_TOPIC_RGB " topic")
+		AVETO_PROPERTY_ENTRY(m_uiSubscribersHalf, "Subscribers Half", "Number of subscribers of the " ZEROMQ_TOPIC_HALF " topic")
+		AVETO_PROPERTY_ENTRY(m_uiSubscribersQuarter, "Subscribers Quarter", "Number of subscribers of the " ZEROMQ_TOPIC_QUARTER " topic")
+		AVETO_PROPERTY_ENTRY(m_ssProfileSubscribers, "Profile Subscribers", "Number of subscribers per profile")
+		AVETO_PROPERTY_ENTRY(m_uiSubscribersBundle, "Subscribers Bundle", "Number of subscribers of the " ZEROMQ_TOPIC_BUNDLE " topic")
+		AVETO_PROPERTY_ENTRY(m_uiBundlesDropped, "Bundles Dropped", "Number of bundles which were dropped (incomplete or not encodable)")
+#if defined(ZMQ_BUILD_DRAFT_API)
+		AVETO_PROPERTY_ENTRY(m_ssMulticastEndpoint, "Multicast Endpoint", "The udp endpoint used for multicast")
+#endif
+		AVETO_PROPERTY_ENTRY(m_uiPoolWaitTime, "Pool Wait Time", "Average time [us] a frame waits for an encode thread")
+		AVETO_PROPERTY_ENTRY(m_uiEncodeTime, "Encode Time", "Average time [us] to encode a frame")
+		AVETO_PROPERTY_ENTRY(m_uiReorderTime, "Reorder Time", "Average time [us] an encoded frame waits for its predecessors")
+		AVETO_PROPERTY_ENTRY(m_uiSendTime, "Send Time", "Average time [us] to send a frame")
 		AVETO_PROPERTY_RESET_READONLY_FLAG()
 	END_AVETO_PROPERTY_MAP()
 
@@ -121,6 +187,14 @@ public:
 	 */
 	void ProcessData(const AVETO::Core::SDataPacket* rgsPackets, uint32_t uiPackets);
 
+	/**
+	 * \brief Processes received data packets of the bundle inputs (see ProcessData).
+	 */
+	void ProcessBundleData0(const AVETO::Core::SDataPacket* rgsPackets, uint32_t uiPackets);
+	void ProcessBundleData1(const AVETO::Core::SDataPacket* rgsPackets, uint32_t uiPackets);
+	void ProcessBundleData2(const AVETO::Core::SDataPacket* rgsPackets, uint32_t uiPackets);
+	void ProcessBundleData3(const AVETO::Core::SDataPacket* rgsPackets, uint32_t uiPackets);
+
 	/**
 	* \brief Reflected connector changed event (forwarded from one of the connectors). Overload of
 	* AvCore::CAvetoMeasObject::OnConnectedConnectorChanged.
@@ -135,36 +209,293 @@ public:
 	virtual void OnConnect(const AVETO::Core::SConnectionEvent& rsConnectInfo) override;
 
 private:
+	/**
+	 * \brief How rate limited streams select the packets they forward.
+	 */
+	enum class EPacingMode : uint32_t
+	{
+		WallClock = 0,												//!< Newest packet once per 1/FPS of wall clock time
+		Timestamp = 1,												//!< One packet per 1/FPS interval of packet timestamps
+		Decimation = 2												//!< Every Nth packet
+	};
+
+	/**
+	 * \brief Properties of the connected input.
+	 */
+	struct SInputInfo
+	{
+		std::string				ssName;
+		uint32_t				uiWidth = 0;
+		uint32_t				uiHeight = 0;
+		uint32_t				uiBPP = 0;
+		bool					bIsRGBA = false;
+		bool					bConnected = false;				//!< An output is connected to the input
+	};
+
+	/**
+	 * \brief How the payload of a frame is encoded. Streams with the same encoding share one message body.
+	 */
+	struct SEncoding
+	{
+		bool					bTransform = false;				//!< Payload is transformed (RGBA inputs only)
+		SPayloadTransform		sTransform;
+		bool					bPayload = true;				//!< If not set only metadata will be sent
+
+		bool operator==(const SEncoding& rOther) const
+		{
+			return bTransform == rOther.bTransform && bPayload == rOther.bPayload &&
+				(!bTransform || sTransform == rOther.sTransform);
+		}
+	};
+
+	/**
+	 * \brief A topic published by this object.
+	 */
+	struct SOutputStream
+	{
+		std::string				ssTopic;
+		SEncoding				sEncoding;
+		bool					bDefaultFPS = false;			//!< Rate follows the "FPS Limit" property
+		bool					bDefaultPayload = false;		//!< Payload follows the "No Payload" property
+		uint32_t				uiFPSLimit = 0;					//!< Forwarding rate (0 = every frame)
+		uint32_t				uiSubscribers = 0;				//!< Number of live subscriptions matching the topic
+		std::chrono::steady_clock::time_point	tNextDue;		//!< Earliest time of the next rate limited frame
+		uint64_t				uiLastSlot = 0;					//!< Timestamp interval of the last forwarded packet
+		bool					bLastSlotValid = false;
+		bool					bMulticast = false;				//!< Sent via multicast, regardless of the subscribers
+	};
+
+	/**
+	 * \brief The messages of one encoding of a frame and the topics they are sent on.
+	 */
+	struct SEncodedMsg
+	{
+		SEncoding					sEncoding;
+		std::vector<std::string>	vecTopics;
+		std::vector<zmq::message_t>	vecBodies;					//!< The parts of a bundle, sent as one multipart message
+		bool						bBundle = false;
+		bool						bFailed = false;			//!< A chunk could not be sent (the remaining chunks are skipped) or a bundle part not encoded
+		std::vector<std::string>	vecRadioGroups;				//!< Topics which are also sent via multicast
+	};
+
+	/**
+	 * \brief A message body or a chunk, handed from the encode stage to the send stage as soon as it is packed.
+	 */
+	struct SEncodedPart
+	{
+		size_t					uiMsg = 0;						//!< Index of the encoded message in SEncodeJob::vecMessages
+		bool					bChunk = false;
+		zmq::message_t			msgBody;
+	};
+
+	using TPartSink = std::function<void(SEncodedPart&& rrsPart)>;
+
+	/**
+	 * \brief A frame on its way through the encode and send stages. Jobs are recycled to reuse their buffers.
+	 */
+	struct SEncodeJob
+	{
+		uint64_t									uiSequence = 0;			//!< Send order
+		std::shared_ptr<AvCore::SDataPacketPtr>		ptrPacket;
+		SInputInfo									sInput;
+		SBundle										sBundle;				//!< Set instead of ptrPacket for bundles
+		std::vector<SInputInfo>						vecBundleInputs;
+		uint32_t									uiChunkThreshold = 0;
+		uint32_t									uiChunkSize = 0;
+		std::vector<SEncodedMsg>					vecMessages;			//!< One entry per distinct encoding
+		size_t										uiMessages = 0;			//!< Used entries of vecMessages
+		std::vector<uint8_t>						vecTransformBuffer;		//!< Transformed payload
+		msgpack::sbuffer							msgBuffer;				//!< Msgpack message buffer
+		std::deque<SEncodedPart>					dequeParts;				//!< Packed, not yet sent parts (m_mtxPacketQueue)
+		std::atomic<bool>							bEncoded{};				//!< Set by the encode stage after the last part (m_mtxPacketQueue)
+		bool										bHead = false;			//!< The send stage started sending the frame (m_mtxPacketQueue)
+		std::chrono::steady_clock::time_point		tSubmitted;
+		std::chrono::steady_clock::time_point		tEncodeStart;
+		std::chrono::steady_clock::time_point		tEncodeEnd;
+		std::chrono::steady_clock::duration			tEncodeBlocked{};		//!< Time the encode stage waited for the send stage
+		std::chrono::steady_clock::time_point		tHead;
+		std::chrono::steady_clock::duration			tSendDuration{};
+	};
+
+	/**
+	 * \brief The payload of a frame in a given encoding, ready to be packed.
+	 */
+	struct SPayload
+	{
+		std::string				ssSource = ZEROMQ_SOURCE;
+		std::string				ssType = "raw";
+		std::string				ssFormat = "RAW";
+		std::array<int, 3>		aFormatSize{ { 0, 0, 0 } };
+		const char*				pData = nullptr;
+		uint32_t				uiNumBytes = 0;
+	};
+
 	std::queue<std::shared_ptr<AvCore::SDataPacketPtr>>			m_queuePackets;					//!< The image data in RGBA format
 	std::mutex													m_mtxPacketQueue;				//!< Protect the packet queue.
+	std::condition_variable										m_cvPacketQueue;				//!< Signals new packets.
+	std::condition_variable										m_cvQueueSpace;					//!< Signals free space in the packet queue.
+	std::condition_variable										m_cvPartSpace;					//!< Signals that the send stage took encoded parts.
 	uint32_t													m_uiFPSLimit;
 	bool														m_bNoPayload;
+	uint32_t													m_uiPacingMode;
+	uint32_t													m_uiDecimation;
+	uint64_t													m_uiPacketIndex;				//!< Index of the current packet (decimation)
+	uint64_t													m_uiLastTimestamp;
+	CSharedString												m_ssProfiles;					//!< Written by the property map
+	std::string													m_ssParsedProfiles;				//!< Profiles m_vecStreams was built from
+	uint32_t													m_uiChunkThreshold;
+	uint32_t													m_uiChunkSize;
+	uint32_t													m_uiEncodeThreads;
+	uint32_t													m_uiBundleTolerance;
+
+	SInputInfo													m_sInput;						//!< Protected by m_mtxPacketQueue
 
-	std::string													m_ssInputName;
-	uint32_t													m_uiInputWidth;
-	uint32_t													m_uiInputHeight;
-	uint32_t													m_uiInputBPP;
-	bool														m_bInputIsRGBA;
+	// Bundles
+	std::queue<std::pair<size_t, std::shared_ptr<AvCore::SDataPacketPtr>>>	m_queueBundlePackets;	//!< Packets of the bundle inputs (m_mtxPacketQueue)
+	std::vector<SInputInfo>										m_vecBundleInputs;				//!< Protected by m_mtxPacketQueue
+	CBundleAssembler											m_BundleAssembler;
+	SOutputStream												m_sBundleStream;
+	uint64_t													m_uiBundleIndex;				//!< Index of the current bundle (decimation)
+	uint64_t													m_uiLastBundleTimestamp;
+	uint32_t													m_uiSubscribersBundle;
+	uint32_t													m_uiBundlesDropped;
+	uint64_t													m_uiBundlesNotEncoded;			//!< Complete bundles with a part which could not be encoded
 
 	// ZeroMQ
-	bool														m_bZeroMqActive{};
 	std::thread													m_ZeroMQThread;					//!< ZeroMQ send thread
 	std::mutex													m_mtxZeroMQMtx;					//!< ZeroMQ Mutex
 	zmq::context_t												m_ZmqCtx;						//!< ZeroMQ context
 	zmq::socket_t												m_ZmqSock;						//!< ZeroMQ bind socket
-	msgpack::sbuffer											m_MsgBuffer;					//!< Msgpack message buffer
-	std::atomic<bool>											m_bZeroMQActive;				//!< ZeroMQ loop active ?
+	std::atomic<bool>											m_bZeroMQActive;				//!< ZeroMQ loop active ? (cleared under m_mtxPacketQueue)
 	int															m_iZmqChannel;
 	int															m_iZmqPort;
+	bool														m_bNoDrop;						//!< ZMQ_XPUB_NODROP is set
+
+	// Multicast
+	CSharedString												m_ssMulticastTopics;			//!< Written by the property map
+	CSharedString												m_ssMulticastInterface;			//!< Written by the property map
+	CSharedString												m_ssMulticastEndpoint;			//!< Read by the property map
+	std::string													m_ssAppliedMulticastTopics;		//!< Multicast topics the streams were flagged with
+	std::string													m_ssConnectedInterface;			//!< Interface m_RadioSock is connected with
+#if defined(ZMQ_BUILD_DRAFT_API)
+	zmq::socket_t												m_RadioSock;					//!< ZeroMQ radio socket (UDP multicast)
+#endif
+	bool														m_bRadioConnected;
+	std::map<std::string, uint32_t>								m_mapRadioSequence;				//!< Message sequence per group
+
+	// Subscriptions
+	std::vector<SOutputStream>									m_vecStreams;					//!< Published topics, only encoded if subscribed
+	std::map<std::string, uint32_t>								m_mapSubscriptions;				//!< Live subscriptions (topic prefix -> count)
+	uint32_t													m_uiSubscribers;
+	uint32_t													m_uiSubscribersRGB;
+	uint32_t													m_uiSubscribersHalf;
+	uint32_t													m_uiSubscribersQuarter;
+	CSharedString												m_ssProfileSubscribers;			//!< Read by the property map
+
+	// Encode pipeline
+	std::shared_ptr<CEncodePool>								m_ptrEncodePool;				//!< Shared with the other forwarding channels
+	std::shared_ptr<SEncodeQueue>								m_ptrEncodeQueue;				//!< Encode tasks of this channel
+	std::deque<std::unique_ptr<SEncodeJob>>						m_dequeJobs;					//!< Frames in flight, in sequence order
+	std::vector<std::unique_ptr<SEncodeJob>>					m_vecFreeJobs;
+	uint64_t													m_uiNextSequence;
+	uint32_t													m_uiPoolWaitTime;
+	uint32_t													m_uiEncodeTime;
+	uint32_t													m_uiReorderTime;
+	uint32_t													m_uiSendTime;
 
 
 	int ZeroMQLoop();
 
-	bool BuildMsgBuffer();
+	void UpdateProfiles();
+
+	void UpdateSubscriptions();
+
+	void CountSubscribers();
+
+	EPacingMode GetPacingMode() const;
+
+	void SelectStreams(bool bNewest, std::chrono::steady_clock::time_point tNow, uint64_t uiTimestamp,
+		std::vector<const SOutputStream*>& rvecSelected);
+
+	bool SelectStream(SOutputStream& rsStream, EPacingMode ePacing, bool bNewest, std::chrono::steady_clock::time_point tNow,
+		uint64_t uiTimestamp, uint64_t uiPacketIndex);
+
+	void ForwardBundles(std::vector<std::pair<size_t, std::shared_ptr<AvCore::SDataPacketPtr>>>& rvecPackets,
+		const std::vector<SInputInfo>& rvecInputs, std::chrono::steady_clock::time_point tNow, size_t uiMaxJobs);
+
+	void UpdateEncodePool(uint32_t uiThreads);
+
+	void UpdateMulticast();
+
+	void ApplyMulticastTopics();
+
+	uint32_t GetEncodeThreads() const;
+
+	std::unique_ptr<SEncodeJob> AcquireJob();
+
+	void SubmitFrame(const std::shared_ptr<AvCore::SDataPacketPtr>& rptrPacket, const SInputInfo& rsInput,
+		const std::vector<const SOutputStream*>& rvecStreams);
+
+	void SubmitBundle(SBundle&& rrsBundle, const std::vector<SInputInfo>& rvecInputs);
+
+	void StartJob(std::unique_ptr<SEncodeJob> ptrJob);
+
+	/**
+	 * \brief Encodes a frame, called on an encode thread (or the send thread if the pool is disabled).
+	 *		Every message body and every chunk is handed to fnSink as soon as it is packed.
+	 */
+	static void EncodeJob(SEncodeJob& rsJob, const TPartSink& fnSink);
+
+	static void EncodeBundle(SEncodeJob& rsJob);
+
+	/**
+	 * \brief Sends the encoded frames in sequence order.
+	 * \param[in] uiMaxPending Waits for the encode stage until at most this many frames are in flight.
+	 */
+	void SendEncoded(size_t uiMaxPending);
+
+	/**
+	 * \brief Sends the parts of the oldest frame while they are packed.
+	 * \param[in] bWait Waits for the encode stage until the frame is complete.
+	 * \return Returns true once all parts of the frame were sent.
+	 */
+	bool SendParts(SEncodeJob& rsJob, bool bWait);
+
+	void SendPart(SEncodeJob& rsJob, SEncodedPart& rsPart);
+
+	/**
+	 * \brief Sends the bundle of a completely encoded frame and updates the stage timing.
+	 */
+	void SendJob(SEncodeJob& rsJob);
+
+	static bool PreparePayload(const AvCore::SDataPacketPtr& rFrame, const SInputInfo& rsInput, const SEncoding& rsEncoding,
+		std::vector<uint8_t>& rvecTransformBuffer, SPayload& rsPayload);
+
+	static void BuildMsgBuffer(const AvCore::SDataPacketPtr& rFrame, const SPayload& rsPayload, msgpack::sbuffer& rMsgBuffer);
+
+	static void BuildChunks(const AvCore::SDataPacketPtr& rFrame, const SPayload& rsPayload, uint32_t uiChunkSize,
+		msgpack::sbuffer& rMsgBuffer, size_t uiMsg, const TPartSink& fnSink);
+
+	void SendMsgBuffer(const std::string& topicStr, zmq::message_t& msgBody);
+
+	bool SendChunk(const SEncodedMsg& rsMsg, zmq::message_t& msgBody);
+
+	bool SendBundle(SEncodedMsg& rsMsg);
+
+	bool SendNoDrop(const std::string& topicStr, zmq::message_t& msgBody, bool bWaitForever);
+
+	void SetNoDrop(bool bNoDrop);
+
+	/**
+	 * \brief Sends a message body once via UDP multicast, split into datagram sized fragments.
+	 */
+	void SendRadio(const std::string& ssGroup, const zmq::message_t& msgBody);
+
+	void ProcessBundleData(size_t uiInput, const AVETO::Core::SDataPacket* rgsPackets, uint32_t uiPackets);
 
-	void SendMsgBuffer();
+	void HandleConnectorChange(const std::string& ssOwnConnectorName, AVETO::Core::TObjID tConnectedConnectorID);
 
-	void HandleConnectorChange(AVETO::Core::TObjID tConnectedConnectorID);
+	void ReadInputInfo(AVETO::Core::TObjID tConnectedConnectorID, SInputInfo& rsInput) const;
 
 	bool IsValidRGBA(AVETO::Core::TObjID tConnectedConnectorID) const;
 };
@@ -0,0 +1,95 @@
+/******************************************************************************/
+/*! \file
+*
+* \verbatim
+******************************************************************************
+*                                                                            *
+*    Copyright (c) 2015-2026, b-plus technologies GmbH.                      *
+*                                                                            *
+*    All rights are reserved by b-plus technologies GmbH.                    *
+*    The Customer is entitled to modify this software under his              *
+*    own license terms.                                                      *
+*                                                                            *
+*    You may use this code according to the license terms of b-plus.         *
+*    Please contact b-plus at services@b-plus.com to get the actual          *
+*    terms and conditions.                                                   *
+*                                                                            *
+******************************************************************************
+\endverbatim
+*
+* \brief Data Forwarding MO - string property shared between threads
+* \author Christopher Maneth
+* \copyright (C)2015-2026 b-plus technologies GmbH
+* \date 19.10.2026
+* \version 2.5
+*
+******************************************************************************/
+
+
+#pragma once
+
+#include <mutex>
+#include <string>
+
+/**
+ * \brief String property which is read and written by the property map and the ZeroMQ thread.
+ *		Every access goes through the conversion / assignment operators or Get() / Set(), which
+ *		copy the value under the internal mutex, so no thread ever sees a string being modified.
+ */
+class CSharedString
+{
+public:
+	CSharedString() = default;
+
+	CSharedString(const char* szValue) :
+		m_ssValue(szValue)
+	{
+	}
+
+	CSharedString(const std::string& rssValue) :
+		m_ssValue(rssValue)
+	{
+	}
+
+	CSharedString(const CSharedString& rOther) :
+		m_ssValue(rOther.Get())
+	{
+	}
+
+	CSharedString& operator=(const CSharedString& rOther)
+	{
+		if (this != &rOther)
+			Set(rOther.Get());
+		return *this;
+	}
+
+	CSharedString& operator=(const std::string& rssValue)
+	{
+		Set(rssValue);
+		return *this;
+	}
+
+	CSharedString& operator=(const char* szValue)
+	{
+		Set(szValue ? szValue : "");
+		return *this;
+	}
+
+	operator std::string() const { return Get(); }
+
+	std::string Get() const
+	{
+		std::unique_lock<std::mutex> lock(m_mtxValue);
+		return m_ssValue;
+	}
+
+	void Set(std::string ssValue)
+	{
+		std::unique_lock<std::mutex> lock(m_mtxValue);
+		m_ssValue.swap(ssValue);
+	}
+
+private:
+	mutable std::mutex		m_mtxValue;
+	std::string				m_ssValue;
+};
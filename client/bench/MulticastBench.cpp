@@ -0,0 +1,326 @@
+/******************************************************************************/
+/*! \file
+*
+* \verbatim
+******************************************************************************
+*                                                                            *
+*    Copyright (c) 2015-2026, b-plus technologies GmbH.                      *
+*                                                                            *
+*    All rights are reserved by b-plus technologies GmbH.                    *
+*    The Customer is entitled to modify this software under his              *
+*    own license terms.                                                      *
+*                                                                            *
+*    You may use this code according to the license terms of b-plus.         *
+*    Please contact b-plus at services@b-plus.com to get the actual          *
+*    terms and conditions.                                                   *
+*                                                                            *
+******************************************************************************
+\endverbatim
+*
+*
+* \brief Data Forwarding Client - unicast (PUB/TCP) against multicast (RADIO/UDP) fan-out
+* \author Christopher Maneth
+* \copyright (C)2015-2026 b-plus technologies GmbH
+* \date 19.10.2026
+* \version 2.5
+*
+* A stand-in forwarding MO publishes RGBA frames at a fixed rate to 1, 2, 4 ... N local subscribers,
+* once via PUB/TCP (one copy per subscriber) and once fragmented via RADIO/UDP multicast (one copy
+* for all subscribers), the same way as SendMsgBuffer / SendRadio. For every subscriber count the
+* delivered frame rate per subscriber, the lost frames, the time the publisher spends sending a
+* frame and the CPU load of the process are printed.
+*
+* The multicast run requires libzmq / cppzmq with draft API (ZMQ_BUILD_DRAFT_API) and multicast
+* enabled on the interface, see README "Multicast".
+*
+* Usage: MulticastBench [--subscribers N] [--width W] [--height H] [--fps F] [--seconds S]
+*		[--port-offset P] [--interface ADDRESS]
+*
+******************************************************************************/
+
+#include <DataForwardingClient.h>
+
+#include <algorithm>
+#include <atomic>
+#include <ctime>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+	struct SConfig
+	{
+		int				iSubscribers = 8;
+		int				iWidth = 1920;
+		int				iHeight = 1080;
+		int				iFps = 30;
+		int				iSeconds = 5;
+		int				iPortOffset = 1000;				//!< Keeps the stand-ins away from a running AVETO instance
+		std::string		ssInterface = "127.0.0.1";
+	};
+
+	struct SResult
+	{
+		uint64_t		uiPublished{};
+		double			dSendSeconds{};					//!< Time spent in the send calls of the publisher
+		double			dCpuSeconds{};					//!< CPU time of the process (publisher and subscribers)
+		double			dSeconds{};
+		uint64_t		uiMinReceived{};
+		uint64_t		uiMaxReceived{};
+		uint64_t		uiInvalid{};
+	};
+
+	const std::string ssTopic = "out/image0";
+
+	void PackFrame(const SConfig& rsConfig, uint64_t uiTimestamp, const std::vector<char>& rvecImage, msgpack::sbuffer& rBuffer)
+	{
+		const std::array<int, 3> aFormatSize{ { rsConfig.iWidth, rsConfig.iHeight, 32 } };
+
+		rBuffer.clear();
+		msgpack::packer<msgpack::sbuffer> packer(&rBuffer);
+		packer.pack(std::string("image0"));
+		packer.pack(uiTimestamp);
+		packer.pack(std::string("image"));
+		packer.pack(std::string("RGBA"));
+		packer.pack(aFormatSize);
+		packer.pack_bin(static_cast<uint32_t>(rvecImage.size()));
+		packer.pack_bin_body(rvecImage.data(), static_cast<uint32_t>(rvecImage.size()));
+	}
+
+	/**
+	 * \brief Publishes frames at the configured rate, fnSend sends one packed frame.
+	 */
+	template <typename TSend>
+	void Publish(const SConfig& rsConfig, SResult& rsResult, TSend fnSend)
+	{
+		std::vector<char> vecImage(static_cast<std::size_t>(rsConfig.iWidth) * rsConfig.iHeight * 4, 1);
+		msgpack::sbuffer buffer;
+
+		const auto tPeriod = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(1.0 / rsConfig.iFps));
+		const uint64_t uiFrames = static_cast<uint64_t>(rsConfig.iFps) * rsConfig.iSeconds;
+		auto tNext = std::chrono::steady_clock::now();
+
+		for (uint64_t uiFrame = 0; uiFrame < uiFrames; uiFrame++)
+		{
+			std::this_thread::sleep_until(tNext);
+			tNext += tPeriod;
+
+			PackFrame(rsConfig, uiFrame, vecImage, buffer);
+
+			const auto tSendStart = std::chrono::steady_clock::now();
+			fnSend(buffer);
+			rsResult.dSendSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - tSendStart).count();
+			rsResult.uiPublished++;
+		}
+	}
+
+	/**
+	 * \brief Starts one thread per subscriber (created by fnCreate) which counts frames until rbActive is reset.
+	 */
+	template <typename TCreate>
+	void RunSubscribers(int iSubscribers, std::atomic<bool>& rbActive, std::vector<uint64_t>& rvecReceived,
+		std::atomic<uint64_t>& ruiInvalid, std::atomic<int>& riReady, std::vector<std::thread>& rvecThreads, TCreate fnCreate)
+	{
+		rvecReceived.assign(iSubscribers, 0);
+		for (int i = 0; i < iSubscribers; i++)
+		{
+			rvecThreads.emplace_back([&, i]()
+			{
+				auto ptrSubscriber = fnCreate();
+				riReady++;
+
+				while (rbActive)
+				{
+					ptrSubscriber->Poll(10ms, [&](auto&&...) { rvecReceived[i]++; });
+				}
+				ruiInvalid += ptrSubscriber->GetInvalidCount();
+			});
+		}
+	}
+
+	template <typename TCreate, typename TSend>
+	SResult Run(const SConfig& rsConfig, int iSubscribers, TCreate fnCreate, TSend fnSend)
+	{
+		SResult sResult;
+		std::atomic<bool> bActive{ true };
+		std::atomic<int> iReady{};
+		std::atomic<uint64_t> uiInvalid{};
+		std::vector<uint64_t> vecReceived;
+		std::vector<std::thread> vecThreads;
+
+		RunSubscribers(iSubscribers, bActive, vecReceived, uiInvalid, iReady, vecThreads, fnCreate);
+		while (iReady < iSubscribers)
+		{
+			std::this_thread::sleep_for(1ms);
+		}
+
+		// give the subscribers time to connect / join
+		std::this_thread::sleep_for(300ms);
+
+		const std::clock_t tCpuStart = std::clock();
+		const auto tStart = std::chrono::steady_clock::now();
+		Publish(rsConfig, sResult, fnSend);
+		sResult.dSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - tStart).count();
+		sResult.dCpuSeconds = static_cast<double>(std::clock() - tCpuStart) / CLOCKS_PER_SEC;
+
+		// let the last frames arrive
+		std::this_thread::sleep_for(300ms);
+		bActive = false;
+		for (auto& rThread : vecThreads)
+		{
+			rThread.join();
+		}
+
+		sResult.uiMinReceived = *std::min_element(vecReceived.begin(), vecReceived.end());
+		sResult.uiMaxReceived = *std::max_element(vecReceived.begin(), vecReceived.end());
+		sResult.uiInvalid = uiInvalid;
+		return sResult;
+	}
+
+	SResult RunUnicast(const SConfig& rsConfig, int iSubscribers)
+	{
+		zmq::context_t ctx;
+		zmq::socket_t sock(ctx, zmq::socket_type::pub);
+		sock.set(zmq::sockopt::linger, 0);
+		sock.set(zmq::sockopt::sndhwm, 3);							// same as the MO
+		sock.bind("tcp://127.0.0.1:" + std::to_string(DataForwarding::FORWARD_START_PORT + rsConfig.iPortOffset));
+
+		auto fnCreate = [&]()
+		{
+			auto ptrClient = std::make_unique<DataForwarding::CClient>("127.0.0.1", DataForwarding::FORWARD_START_PORT + rsConfig.iPortOffset);
+			ptrClient->AddChannel(0);
+			return ptrClient;
+		};
+
+		auto fnSend = [&](const msgpack::sbuffer& rBuffer)
+		{
+			zmq::message_t topic(ssTopic.data(), ssTopic.size());
+			zmq::message_t msg(rBuffer.data(), rBuffer.size());
+			sock.send(topic, zmq::send_flags::sndmore);
+			sock.send(msg, zmq::send_flags::none);
+		};
+
+		return Run(rsConfig, iSubscribers, fnCreate, fnSend);
+	}
+
+#if defined(ZMQ_BUILD_DRAFT_API)
+	SResult RunMulticast(const SConfig& rsConfig, int iSubscribers)
+	{
+		const int iPort = DataForwarding::MULTICAST_START_PORT + rsConfig.iPortOffset;
+
+		zmq::context_t ctx;
+		zmq::socket_t sock(ctx, zmq::socket_type::radio);
+		sock.set(zmq::sockopt::linger, 0);
+		sock.set(zmq::sockopt::sndhwm, 65536);
+		sock.connect("udp://" + rsConfig.ssInterface + ";" + DataForwarding::MULTICAST_ADDRESS + ":" + std::to_string(iPort));
+
+		auto fnCreate = [&]()
+		{
+			auto ptrReceiver = std::make_unique<DataForwarding::CMulticastReceiver>(0, rsConfig.ssInterface, iPort);
+			ptrReceiver->Join(ssTopic);
+			return ptrReceiver;
+		};
+
+		// fragments the same way as CProcessorObject::SendRadio
+		uint32_t uiSequence = 0;
+		const std::size_t uiFragmentSize = DataForwarding::MULTICAST_DATAGRAM_SIZE - 1 - ssTopic.size() - DataForwarding::FRAGMENT_HEADER_SIZE;
+		auto fnSend = [&](const msgpack::sbuffer& rBuffer)
+		{
+			const std::size_t uiTotalSize = rBuffer.size();
+			const std::size_t uiFragments = std::max<std::size_t>(1, (uiTotalSize + uiFragmentSize - 1) / uiFragmentSize);
+
+			DataForwarding::SFragmentHeader sHeader;
+			sHeader.uiSequence = uiSequence++;
+			sHeader.uiCount = static_cast<uint16_t>(uiFragments);
+			sHeader.uiTotalSize = static_cast<uint32_t>(uiTotalSize);
+
+			for (std::size_t uiFragment = 0; uiFragment < uiFragments; uiFragment++)
+			{
+				const std::size_t uiOffset = uiFragment * uiFragmentSize;
+				const std::size_t uiNumBytes = std::min(uiFragmentSize, uiTotalSize - uiOffset);
+
+				sHeader.uiIndex = static_cast<uint16_t>(uiFragment);
+				sHeader.uiOffset = static_cast<uint32_t>(uiOffset);
+
+				zmq::message_t msg(DataForwarding::FRAGMENT_HEADER_SIZE + uiNumBytes);
+				uint8_t* pData = static_cast<uint8_t*>(msg.data());
+				sHeader.Write(pData);
+				memcpy(pData + DataForwarding::FRAGMENT_HEADER_SIZE, rBuffer.data() + uiOffset, uiNumBytes);
+
+				msg.set_group(ssTopic.c_str());
+				sock.send(msg, zmq::send_flags::dontwait);
+			}
+		};
+
+		return Run(rsConfig, iSubscribers, fnCreate, fnSend);
+	}
+#endif
+
+	void Print(const char* szMode, int iSubscribers, const SResult& rsResult)
+	{
+		const double dPublished = static_cast<double>(std::max<uint64_t>(rsResult.uiPublished, 1));
+
+		std::cout << std::left << std::setw(11) << szMode << std::right
+			<< std::setw(5) << iSubscribers
+			<< std::setw(12) << std::fixed << std::setprecision(1) << rsResult.uiMinReceived / rsResult.dSeconds
+			<< std::setw(10) << rsResult.uiPublished - std::min(rsResult.uiMinReceived, rsResult.uiPublished)
+			<< std::setw(13) << std::setprecision(2) << rsResult.dSendSeconds * 1000.0 / dPublished
+			<< std::setw(9) << std::setprecision(1) << rsResult.dCpuSeconds * 100.0 / rsResult.dSeconds
+			<< std::setw(9) << rsResult.uiInvalid << std::endl;
+	}
+
+	SConfig ParseArgs(int argc, char** argv)
+	{
+		SConfig sConfig;
+		for (int i = 1; i + 1 < argc; i += 2)
+		{
+			const std::string ssKey = argv[i];
+			const int iValue = std::atoi(argv[i + 1]);
+
+			if (ssKey == "--subscribers")		sConfig.iSubscribers = iValue;
+			else if (ssKey == "--width")		sConfig.iWidth = iValue;
+			else if (ssKey == "--height")		sConfig.iHeight = iValue;
+			else if (ssKey == "--fps")			sConfig.iFps = std::max(iValue, 1);
+			else if (ssKey == "--seconds")		sConfig.iSeconds = iValue;
+			else if (ssKey == "--port-offset")	sConfig.iPortOffset = iValue;
+			else if (ssKey == "--interface")	sConfig.ssInterface = argv[i + 1];
+		}
+		return sConfig;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const SConfig sConfig = ParseArgs(argc, argv);
+
+	std::cout << "frame size: " << sConfig.iWidth << "x" << sConfig.iHeight << " RGBA, " << sConfig.iFps << " fps, "
+		<< sConfig.iSeconds << " s per run" << std::endl;
+	std::cout << "mode        subs  frames/s/sub      lost  send ms/frame     cpu%  invalid" << std::endl;
+
+	bool bSuccess = true;
+	for (int iSubscribers = 1; iSubscribers <= sConfig.iSubscribers; iSubscribers *= 2)
+	{
+		const SResult sUnicast = RunUnicast(sConfig, iSubscribers);
+		Print("pub/tcp", iSubscribers, sUnicast);
+		bSuccess &= sUnicast.uiMinReceived > 0;
+
+#if defined(ZMQ_BUILD_DRAFT_API)
+		const SResult sMulticast = RunMulticast(sConfig, iSubscribers);
+		Print("radio/udp", iSubscribers, sMulticast);
+		bSuccess &= sMulticast.uiMinReceived > 0;
+#endif
+	}
+
+#if !defined(ZMQ_BUILD_DRAFT_API)
+	std::cout << "multicast skipped: built without ZMQ_BUILD_DRAFT_API" << std::endl;
+#endif
+
+	return bSuccess ? EXIT_SUCCESS : EXIT_FAILURE;
+}
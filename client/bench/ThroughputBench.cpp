@@ -0,0 +1,234 @@
+/******************************************************************************/
+/*! \file
+*
+* \verbatim
+******************************************************************************
+*                                                                            *
+*    Copyright (c) 2015-2026, b-plus technologies GmbH.                      *
+*                                                                            *
+*    All rights are reserved by b-plus technologies GmbH.                    *
+*    The Customer is entitled to modify this software under his              *
+*    own license terms.                                                      *
+*                                                                            *
+*    You may use this code according to the license terms of b-plus.         *
+*    Please contact b-plus at services@b-plus.com to get the actual          *
+*    terms and conditions.                                                   *
+*                                                                            *
+******************************************************************************
+\endverbatim
+*
+* \brief Data Forwarding Client - throughput test against local stand-ins for both MOs
+* \author Christopher Maneth
+* \copyright (C)2015-2026 b-plus technologies GmbH
+* \date 19.10.2026
+* \version 2.5
+*
+* The stand-in forwarding MO publishes RGBA frames in the forwarding message format as fast as
+* possible, the client library receives them, builds a backwarding message for every frame and
+* pushes it to the stand-in backwarding MO, which validates and counts the results.
+*
+* Usage: ThroughputBench [--channels N] [--width W] [--height H] [--seconds S] [--port-offset P]
+*
+******************************************************************************/
+
+#include <DataForwardingClient.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+	struct SConfig
+	{
+		int			iChannels = 1;
+		int			iWidth = 1920;
+		int			iHeight = 1080;
+		int			iSeconds = 5;
+		int			iPortOffset = 1000;				//!< Keeps the stand-ins away from a running AVETO instance
+	};
+
+	struct SCounters
+	{
+		std::atomic<uint64_t>		uiPublished{};
+		std::atomic<uint64_t>		uiReceived{};
+		std::atomic<uint64_t>		uiReturned{};
+		std::atomic<uint64_t>		uiReturnedValid{};
+	};
+
+	/**
+	 * \brief Stand-in for the Data Forwarding MO, packs messages the same way as BuildMsgBuffer / SendMsgBuffer.
+	 */
+	void ForwardingStandIn(zmq::context_t& rCtx, const SConfig& rsConfig, int iChannel, std::atomic<bool>& rbActive, SCounters& rCounters)
+	{
+		zmq::socket_t sock(rCtx, zmq::socket_type::pub);
+		sock.set(zmq::sockopt::linger, 0);
+		sock.set(zmq::sockopt::sndhwm, 3);						// same as the MO, frames are dropped instead of queued
+		sock.bind("tcp://127.0.0.1:" + std::to_string(DataForwarding::FORWARD_START_PORT + rsConfig.iPortOffset + iChannel));
+
+		const std::string ssTopic = "out/image0";
+		const uint32_t uiNumBytes = rsConfig.iWidth * rsConfig.iHeight * 4;
+		std::vector<char> vecImage(uiNumBytes, static_cast<char>(iChannel));
+		const std::array<int, 3> aFormatSize{ { rsConfig.iWidth, rsConfig.iHeight, 32 } };
+
+		// give the subscribers time to connect
+		std::this_thread::sleep_for(300ms);
+
+		msgpack::sbuffer buffer;
+		uint64_t uiTimestamp = 0;
+		while (rbActive)
+		{
+			msgpack::packer<msgpack::sbuffer> packer(&buffer);
+			packer.pack(std::string("image0"));
+			packer.pack(uiTimestamp++);
+			packer.pack(std::string("image"));
+			packer.pack(std::string("RGBA"));
+			packer.pack(aFormatSize);
+			packer.pack_bin(uiNumBytes);
+			packer.pack_bin_body(vecImage.data(), uiNumBytes);
+
+			zmq::message_t topic(ssTopic.data(), ssTopic.size());
+			zmq::message_t msg(buffer.data(), buffer.size());
+			sock.send(topic, zmq::send_flags::sndmore);
+			sock.send(msg, zmq::send_flags::none);
+			buffer.clear();
+
+			rCounters.uiPublished++;
+		}
+	}
+
+	/**
+	 * \brief Stand-in for the Data Backwarding MO, validates the received results.
+	 */
+	void BackwardingStandIn(zmq::context_t& rCtx, const SConfig& rsConfig, int iChannel, std::atomic<bool>& rbActive, SCounters& rCounters)
+	{
+		zmq::socket_t sock(rCtx, zmq::socket_type::pull);
+		sock.set(zmq::sockopt::linger, 0);
+		sock.set(zmq::sockopt::rcvtimeo, 100);
+		sock.bind("tcp://127.0.0.1:" + std::to_string(DataForwarding::BACKWARD_START_PORT + rsConfig.iPortOffset + iChannel));
+
+		msgpack::zone zone;
+		while (rbActive)
+		{
+			zmq::message_t msg;
+			if (!sock.recv(msg, zmq::recv_flags::none))
+				continue;
+
+			rCounters.uiReturned++;
+
+			zone.clear();
+			DataForwarding::detail::CMsgReader reader(zone, msg.data(), msg.size());
+			std::string_view svTarget, svType, svFormat, svMeta;
+			uint64_t uiTimestamp = 0;
+			std::array<int, 3> aFormatSize{};
+			const uint8_t* pImage = nullptr;
+			std::size_t uiImageSize = 0;
+
+			if (reader.NextString(svTarget) && reader.NextUInt(uiTimestamp) && reader.NextString(svType) &&
+				reader.NextString(svFormat) && reader.NextFormatSize(aFormatSize) && reader.NextString(svMeta) &&
+				reader.NextBin(pImage, uiImageSize) &&
+				svTarget == "image0" && svType == "image" && svFormat == "RGBA" &&
+				uiImageSize == static_cast<std::size_t>(aFormatSize[0]) * aFormatSize[1] * (aFormatSize[2] / 8))
+			{
+				rCounters.uiReturnedValid++;
+			}
+		}
+	}
+
+	SConfig ParseArgs(int argc, char** argv)
+	{
+		SConfig sConfig;
+		for (int i = 1; i + 1 < argc; i += 2)
+		{
+			const std::string ssKey = argv[i];
+			const int iValue = std::atoi(argv[i + 1]);
+
+			if (ssKey == "--channels")			sConfig.iChannels = iValue;
+			else if (ssKey == "--width")		sConfig.iWidth = iValue;
+			else if (ssKey == "--height")		sConfig.iHeight = iValue;
+			else if (ssKey == "--seconds")		sConfig.iSeconds = iValue;
+			else if (ssKey == "--port-offset")	sConfig.iPortOffset = iValue;
+		}
+		return sConfig;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const SConfig sConfig = ParseArgs(argc, argv);
+
+	zmq::context_t ctxStandIn;
+	std::atomic<bool> bStandInActive{ true };
+	SCounters counters;
+	std::vector<std::thread> vecStandIns;
+
+	for (int iChannel = 0; iChannel < sConfig.iChannels; iChannel++)
+	{
+		vecStandIns.emplace_back(ForwardingStandIn, std::ref(ctxStandIn), std::cref(sConfig), iChannel, std::ref(bStandInActive), std::ref(counters));
+		vecStandIns.emplace_back(BackwardingStandIn, std::ref(ctxStandIn), std::cref(sConfig), iChannel, std::ref(bStandInActive), std::ref(counters));
+	}
+
+	uint64_t uiReceivedBytes = 0;
+	{
+		DataForwarding::CClient client("127.0.0.1",
+			DataForwarding::FORWARD_START_PORT + sConfig.iPortOffset,
+			DataForwarding::BACKWARD_START_PORT + sConfig.iPortOffset);
+		DataForwarding::CBackwardBuilder builder(8, static_cast<std::size_t>(sConfig.iWidth) * sConfig.iHeight * 4 + 256);
+
+		for (int iChannel = 0; iChannel < sConfig.iChannels; iChannel++)
+		{
+			client.AddChannel(iChannel, iChannel);
+		}
+
+		auto fnHandler = [&](std::size_t uiChannel, const DataForwarding::CFrameView& rFrame)
+		{
+			counters.uiReceived++;
+			uiReceivedBytes += rFrame.PayloadSize();
+
+			if (!rFrame.IsImage() || rFrame.IsChunk())
+				return;
+
+			DataForwarding::SBackwardHeader sHeader;
+			sHeader.svTarget = rFrame.Source();
+			sHeader.uiTimestamp = rFrame.Timestamp();
+			sHeader.aFormatSize = rFrame.FormatSize();
+			sHeader.svMetaData = "{\"detections\": 0}";
+
+			// "processing": write the result directly into the outgoing message
+			uint8_t* pResult = builder.Begin(sHeader, rFrame.PayloadSize());
+			memcpy(pResult, rFrame.Payload(), rFrame.PayloadSize());
+			client.Send(uiChannel, builder.Finish());
+		};
+
+		const auto tStart = std::chrono::steady_clock::now();
+		const auto tEnd = tStart + std::chrono::seconds(sConfig.iSeconds) + 300ms;
+		while (std::chrono::steady_clock::now() < tEnd)
+		{
+			client.Poll(10ms, fnHandler);
+		}
+
+		bStandInActive = false;
+		for (auto& rThread : vecStandIns)
+		{
+			rThread.join();
+		}
+
+		const double dSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - tStart).count();
+
+		std::cout << "channels:        " << sConfig.iChannels << std::endl;
+		std::cout << "frame size:      " << sConfig.iWidth << "x" << sConfig.iHeight << " RGBA" << std::endl;
+		std::cout << "published:       " << counters.uiPublished << std::endl;
+		std::cout << "received:        " << counters.uiReceived << " (" << counters.uiReceived / dSeconds << " frames/s, "
+			<< uiReceivedBytes / dSeconds / (1024.0 * 1024.0) << " MiB/s)" << std::endl;
+		std::cout << "returned:        " << counters.uiReturned << " (" << counters.uiReturnedValid << " valid)" << std::endl;
+		std::cout << "invalid frames:  " << client.GetInvalidCount() << std::endl;
+	}
+
+	return counters.uiReceived > 0 && counters.uiReturnedValid > 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,264 @@
+/******************************************************************************/
+/*! \file
+*
+* \verbatim
+******************************************************************************
+*                                                                            *
+*    Copyright (c) 2015-2026, b-plus technologies GmbH.                      *
+*                                                                            *
+*    All rights are reserved by b-plus technologies GmbH.                    *
+*    The Customer is entitled to modify this software under his              *
+*    own license terms.                                                      *
+*                                                                            *
+*    You may use this code according to the license terms of b-plus.         *
+*    Please contact b-plus at services@b-plus.com to get the actual          *
+*    terms and conditions.                                                   *
+*                                                                            *
+******************************************************************************
+\endverbatim
+*
+* \brief Data Forwarding Client - in place builder for backwarding messages
+* \author Christopher Maneth
+* \copyright (C)2015-2026 b-plus technologies GmbH
+* \date 19.10.2026
+* \version 2.5
+*
+******************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <msgpack.hpp>
+#include <zmq.hpp>
+
+#include "FrameView.h"
+
+namespace DataForwarding
+{
+	/**
+	 * \brief Header fields of a backwarding message (see README "Message format").
+	 */
+	struct SBackwardHeader
+	{
+		std::string_view		svTarget = "image0";
+		uint64_t				uiTimestamp = 0;
+		std::string_view		svType = "image";
+		std::string_view		svFormat = "RGBA";
+		std::array<int, 3>		aFormatSize{ { 0, 0, 32 } };
+		std::string_view		svMetaData;
+	};
+
+	namespace detail
+	{
+		/**
+		 * \brief Allocator which leaves resized elements uninitialized, so growing a buffer does not
+		 *		clear the payload area the caller is going to overwrite anyway.
+		 */
+		template <typename T>
+		struct SDefaultInitAllocator : std::allocator<T>
+		{
+			template <typename U>
+			struct rebind
+			{
+				using other = SDefaultInitAllocator<U>;
+			};
+
+			SDefaultInitAllocator() = default;
+
+			template <typename U>
+			SDefaultInitAllocator(const SDefaultInitAllocator<U>&) noexcept
+			{
+			}
+
+			template <typename U>
+			void construct(U* p) noexcept(std::is_nothrow_default_constructible<U>::value)
+			{
+				::new (static_cast<void*>(p)) U;
+			}
+
+			template <typename U, typename... TArgs>
+			void construct(U* p, TArgs&&... args)
+			{
+				::new (static_cast<void*>(p)) U(std::forward<TArgs>(args)...);
+			}
+		};
+
+		using TMsgData = std::vector<char, SDefaultInitAllocator<char>>;
+
+		struct SBufferPool;
+
+		/**
+		 * \brief A message buffer which is handed to ZeroMQ without copy and returns to its pool once sent.
+		 */
+		struct SPooledBuffer
+		{
+			TMsgData						vecData;
+			std::shared_ptr<SBufferPool>	ptrOwner;				//!< Only set while the buffer is owned by ZeroMQ
+		};
+
+		struct SBufferPool
+		{
+			std::mutex										mtx;
+			std::vector<std::unique_ptr<SPooledBuffer>>		vecFree;
+		};
+
+		/**
+		 * \brief Stream adapter for msgpack::packer which appends to a message buffer without shrinking it.
+		 */
+		struct SVectorWriter
+		{
+			TMsgData& rvecData;
+
+			void write(const char* pData, std::size_t uiSize)
+			{
+				rvecData.insert(rvecData.end(), pData, pData + uiSize);
+			}
+		};
+
+		/**
+		 * \brief ZeroMQ free function, called from the ZeroMQ I/O thread once a message has been sent.
+		 */
+		inline void ReleasePooledBuffer(void*, void* pHint)
+		{
+			auto* pBuffer = static_cast<SPooledBuffer*>(pHint);
+
+			// keep the pool alive until the buffer is back in its free list
+			auto ptrPool = std::move(pBuffer->ptrOwner);
+			std::unique_lock<std::mutex> lock(ptrPool->mtx);
+			ptrPool->vecFree.emplace_back(pBuffer);
+		}
+	}
+
+	/**
+	 * \brief Builds backwarding messages in place.
+	 *		The header is packed directly in front of the payload area of a preallocated buffer, the
+	 *		caller writes the payload into the returned pointer and Finish() hands the buffer to ZeroMQ
+	 *		without copying it. Sent buffers are recycled, so in steady state no memory is allocated.
+	 *
+	 * Usage:
+	 *		uint8_t* pPayload = builder.Begin(sHeader, uiPayloadSize);
+	 *		// ... write uiPayloadSize bytes to pPayload ...
+	 *		client.Send(uiChannel, builder.Finish());
+	 *
+	 * Large results can be sent in chunks, every chunk is a complete message which is sent as soon as
+	 * it is written (the Data Backwarding MO reassembles them, the meta data may be sent with any chunk):
+	 *		SChunkInfo sChunk{ uiOffset, uiTotalSize, uiIndex, uiCount };
+	 *		uint8_t* pChunk = builder.Begin(sHeader, uiChunkBytes, &sChunk);
+	 */
+	class CBackwardBuilder
+	{
+	public:
+		/**
+		 * \param[in] uiPreallocBuffers Number of buffers created up front.
+		 * \param[in] uiPreallocBytes Capacity reserved for each of these buffers.
+		 */
+		explicit CBackwardBuilder(std::size_t uiPreallocBuffers = 4, std::size_t uiPreallocBytes = 0) :
+			m_ptrPool(std::make_shared<detail::SBufferPool>())
+		{
+			for (std::size_t i = 0; i < uiPreallocBuffers; i++)
+			{
+				auto ptrBuffer = std::make_unique<detail::SPooledBuffer>();
+				ptrBuffer->vecData.reserve(uiPreallocBytes);
+				m_ptrPool->vecFree.push_back(std::move(ptrBuffer));
+			}
+		}
+
+		CBackwardBuilder(const CBackwardBuilder&) = delete;
+		CBackwardBuilder& operator=(const CBackwardBuilder&) = delete;
+
+		/**
+		 * \brief Starts a new message and packs its header.
+		 * \param[in] rsHeader The header fields.
+		 * \param[in] uiPayloadSize Size of the payload in bytes (of this chunk for chunked messages).
+		 * \param[in] psChunk If set a chunked message is built, the type gets the chunk suffix.
+		 * \return Pointer to the uninitialized payload area (uiPayloadSize bytes), valid until Finish().
+		 */
+		uint8_t* Begin(const SBackwardHeader& rsHeader, std::size_t uiPayloadSize, const SChunkInfo* psChunk = nullptr)
+		{
+			if (!m_ptrCurrent)
+				m_ptrCurrent = AcquireBuffer();
+
+			auto& rvecData = m_ptrCurrent->vecData;
+			rvecData.clear();
+
+			detail::SVectorWriter writer{ rvecData };
+			msgpack::packer<detail::SVectorWriter> packer(writer);
+			packer.pack_str(static_cast<uint32_t>(rsHeader.svTarget.size()));
+			packer.pack_str_body(rsHeader.svTarget.data(), static_cast<uint32_t>(rsHeader.svTarget.size()));
+			packer.pack(rsHeader.uiTimestamp);
+			const std::string_view svSuffix = psChunk ? CHUNK_TYPE_SUFFIX : std::string_view();
+			packer.pack_str(static_cast<uint32_t>(rsHeader.svType.size() + svSuffix.size()));
+			packer.pack_str_body(rsHeader.svType.data(), static_cast<uint32_t>(rsHeader.svType.size()));
+			packer.pack_str_body(svSuffix.data(), static_cast<uint32_t>(svSuffix.size()));
+			packer.pack_str(static_cast<uint32_t>(rsHeader.svFormat.size()));
+			packer.pack_str_body(rsHeader.svFormat.data(), static_cast<uint32_t>(rsHeader.svFormat.size()));
+			packer.pack(rsHeader.aFormatSize);
+			packer.pack_str(static_cast<uint32_t>(rsHeader.svMetaData.size()));
+			packer.pack_str_body(rsHeader.svMetaData.data(), static_cast<uint32_t>(rsHeader.svMetaData.size()));
+			if (psChunk)
+			{
+				packer.pack_array(4);
+				packer.pack(psChunk->uiOffset);
+				packer.pack(psChunk->uiTotalSize);
+				packer.pack(psChunk->uiIndex);
+				packer.pack(psChunk->uiCount);
+			}
+			packer.pack_bin(static_cast<uint32_t>(uiPayloadSize));
+
+			const std::size_t uiHeaderSize = rvecData.size();
+			rvecData.resize(uiHeaderSize + uiPayloadSize);
+
+			return reinterpret_cast<uint8_t*>(rvecData.data() + uiHeaderSize);
+		}
+
+		/**
+		 * \brief Convenience overload which copies an existing payload.
+		 */
+		void Build(const SBackwardHeader& rsHeader, const void* pPayload, std::size_t uiPayloadSize, const SChunkInfo* psChunk = nullptr)
+		{
+			uint8_t* pDst = Begin(rsHeader, uiPayloadSize, psChunk);
+			if (uiPayloadSize > 0)
+				memcpy(pDst, pPayload, uiPayloadSize);
+		}
+
+		/**
+		 * \brief Finishes the current message.
+		 * \return A message referencing the builder buffer (no copy). The buffer returns to the
+		 *		builder as soon as ZeroMQ released the message.
+		 */
+		zmq::message_t Finish()
+		{
+			if (!m_ptrCurrent)
+				return zmq::message_t();
+
+			detail::SPooledBuffer* pBuffer = m_ptrCurrent.release();
+			pBuffer->ptrOwner = m_ptrPool;
+
+			return zmq::message_t(pBuffer->vecData.data(), pBuffer->vecData.size(),
+				&detail::ReleasePooledBuffer, pBuffer);
+		}
+
+	private:
+		std::unique_ptr<detail::SPooledBuffer> AcquireBuffer()
+		{
+			std::unique_lock<std::mutex> lock(m_ptrPool->mtx);
+			if (m_ptrPool->vecFree.empty())
+				return std::make_unique<detail::SPooledBuffer>();
+
+			auto ptrBuffer = std::move(m_ptrPool->vecFree.back());
+			m_ptrPool->vecFree.pop_back();
+			return ptrBuffer;
+		}
+
+		std::shared_ptr<detail::SBufferPool>			m_ptrPool;			//!< Recycled message buffers
+		std::unique_ptr<detail::SPooledBuffer>			m_ptrCurrent;		//!< Buffer of the message currently being built
+	};
+}
@@ -0,0 +1,196 @@
+/******************************************************************************/
+/*! \file
+*
+* \verbatim
+******************************************************************************
+*                                                                            *
+*    Copyright (c) 2015-2026, b-plus technologies GmbH.                      *
+*                                                                            *
+*    All rights are reserved by b-plus technologies GmbH.                    *
+*    The Customer is entitled to modify this software under his              *
+*    own license terms.                                                      *
+*                                                                            *
+*    You may use this code according to the license terms of b-plus.         *
+*    Please contact b-plus at services@b-plus.com to get the actual          *
+*    terms and conditions.                                                   *
+*                                                                            *
+******************************************************************************
+\endverbatim
+*
+* \brief Data Forwarding Client - reassembly of chunked forwarding messages
+* \author Christopher Maneth
+* \copyright (C)2015-2026 b-plus technologies GmbH
+* \date 19.10.2026
+* \version 2.5
+*
+******************************************************************************/
+
+
+#pragma once
+
+#include "FrameView.h"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace DataForwarding
+{
+	/**
+	 * \brief Reassembles the chunks of chunked forwarding messages into one contiguous payload.
+	 *		The payload buffer is reused between frames (or supplied by the caller), so in steady state no
+	 *		memory is allocated. Chunks may arrive in any order; a chunk of a new frame drops a frame which
+	 *		is still incomplete (chunk loss) and counts it. Chunks which do not match their header (or the
+	 *		other chunks of the frame) and frames larger than MAX_REASSEMBLY_SIZE are counted as invalid.
+	 *
+	 * Usage (inside the frame handler):
+	 *		if (rFrame.IsChunk() && assembler.Add(rFrame))
+	 *			Process(assembler.Payload(), assembler.PayloadSize());
+	 */
+	class CChunkAssembler
+	{
+	public:
+		CChunkAssembler() = default;
+
+		/**
+		 * \brief Uses a caller owned buffer instead of the internal one.
+		 *		Frames larger than uiSize are dropped.
+		 */
+		void SetExternalBuffer(uint8_t* pBuffer, std::size_t uiSize)
+		{
+			m_pExternal = pBuffer;
+			m_uiExternalSize = uiSize;
+		}
+
+		/**
+		 * \brief Adds a chunk.
+		 * \return Returns true if the frame of this chunk is complete.
+		 */
+		bool Add(const CFrameView& rFrame)
+		{
+			if (!rFrame.IsChunk())
+				return false;
+
+			const SChunkInfo& rsChunk = rFrame.Chunk();
+			uint64_t uiChunkSize = 0;
+			if (!detail::CheckPiece(rsChunk.uiOffset, rFrame.PayloadSize(), rsChunk.uiTotalSize, rsChunk.uiIndex, rsChunk.uiCount, uiChunkSize) ||
+				rsChunk.uiTotalSize > MAX_REASSEMBLY_SIZE)
+			{
+				m_uiInvalidChunks++;
+				return false;
+			}
+
+			if (!m_bActive || rFrame.Timestamp() != m_uiTimestamp || rFrame.Source() != m_ssSource ||
+				rsChunk.uiTotalSize != m_uiTotalSize || rsChunk.uiCount != m_vecReceived.size())
+			{
+				if (!Start(rFrame, uiChunkSize))
+					return false;
+			}
+			else if (uiChunkSize != m_uiChunkSize)
+			{
+				m_uiInvalidChunks++;										// does not fit the chunks received so far
+				return false;
+			}
+
+			if (m_vecReceived[rsChunk.uiIndex])
+				return false;  // duplicate
+
+			memcpy(Buffer() + rsChunk.uiOffset, rFrame.Payload(), rFrame.PayloadSize());
+			m_vecReceived[rsChunk.uiIndex] = true;
+			m_uiReceivedChunks++;
+
+			if (m_uiReceivedChunks < m_vecReceived.size())
+				return false;
+
+			m_bActive = false;
+			m_uiCompleteFrames++;
+			return true;
+		}
+
+		/**
+		 * \brief Number of bytes of the current frame which are already in place, from the start of
+		 *		the payload. Allows processing rows progressively while chunks arrive in order.
+		 */
+		std::size_t ContiguousBytes() const
+		{
+			std::size_t uiChunks = 0;
+			while (uiChunks < m_vecReceived.size() && m_vecReceived[uiChunks])
+			{
+				uiChunks++;
+			}
+
+			if (uiChunks == m_vecReceived.size())
+				return static_cast<std::size_t>(m_uiTotalSize);
+
+			return uiChunks * m_uiChunkSize;
+		}
+
+		const uint8_t* Payload() const { return m_pExternal ? m_pExternal : m_vecBuffer.data(); }
+		std::size_t PayloadSize() const { return static_cast<std::size_t>(m_uiTotalSize); }
+		uint64_t Timestamp() const { return m_uiTimestamp; }
+		const std::string& Source() const { return m_ssSource; }
+		const std::string& Type() const { return m_ssType; }
+		const std::string& Format() const { return m_ssFormat; }
+		const std::array<int, 3>& FormatSize() const { return m_aFormatSize; }
+
+		uint64_t GetCompleteCount() const { return m_uiCompleteFrames; }
+		uint64_t GetIncompleteCount() const { return m_uiIncompleteFrames; }
+		uint64_t GetInvalidChunkCount() const { return m_uiInvalidChunks; }
+
+	private:
+		bool Start(const CFrameView& rFrame, uint64_t uiChunkSize)
+		{
+			if (m_bActive)
+				m_uiIncompleteFrames++;
+
+			const SChunkInfo& rsChunk = rFrame.Chunk();
+			m_bActive = false;
+
+			if (m_pExternal)
+			{
+				if (rsChunk.uiTotalSize > m_uiExternalSize)
+				{
+					m_uiInvalidChunks++;
+					return false;
+				}
+			}
+			else
+			{
+				m_vecBuffer.resize(static_cast<std::size_t>(rsChunk.uiTotalSize));
+			}
+
+			m_bActive = true;
+			m_uiTimestamp = rFrame.Timestamp();
+			m_ssSource.assign(rFrame.Source());
+			m_ssType.assign(rFrame.Type());
+			m_ssFormat.assign(rFrame.Format());
+			m_aFormatSize = rFrame.FormatSize();
+			m_uiTotalSize = rsChunk.uiTotalSize;
+			m_uiChunkSize = static_cast<std::size_t>(uiChunkSize);
+			m_vecReceived.assign(static_cast<std::size_t>(rsChunk.uiCount), false);
+			m_uiReceivedChunks = 0;
+			return true;
+		}
+
+		uint8_t* Buffer() { return m_pExternal ? m_pExternal : m_vecBuffer.data(); }
+
+		std::vector<uint8_t>		m_vecBuffer;
+		uint8_t*					m_pExternal{};
+		std::size_t					m_uiExternalSize{};
+
+		bool						m_bActive{};
+		uint64_t					m_uiTimestamp{};
+		std::string					m_ssSource;
+		std::string					m_ssType;
+		std::string					m_ssFormat;
+		std::array<int, 3>			m_aFormatSize{ { 0, 0, 0 } };
+		uint64_t					m_uiTotalSize{};
+		std::size_t					m_uiChunkSize{};					//!< Size of all but the last chunk
+		std::vector<bool>			m_vecReceived;
+		std::size_t					m_uiReceivedChunks{};
+
+		uint64_t					m_uiCompleteFrames{};
+		uint64_t					m_uiIncompleteFrames{};
+		uint64_t					m_uiInvalidChunks{};
+	};
+}
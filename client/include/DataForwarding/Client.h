@@ -0,0 +1,323 @@
+/******************************************************************************/
+/*! \file
+*
+* \verbatim
+******************************************************************************
+*                                                                            *
+*    Copyright (c) 2015-2026, b-plus technologies GmbH.                      *
+*                                                                            *
+*    All rights are reserved by b-plus technologies GmbH.                    *
+*    The Customer is entitled to modify this software under his              *
+*    own license terms.                                                      *
+*                                                                            *
+*    You may use this code according to the license terms of b-plus.         *
+*    Please contact b-plus at services@b-plus.com to get the actual          *
+*    terms and conditions.                                                   *
+*                                                                            *
+******************************************************************************
+\endverbatim
+*
+* \brief Data Forwarding Client - multi channel connection to the forwarding / backwarding MOs
+* \author Christopher Maneth
+* \copyright (C)2015-2026 b-plus technologies GmbH
+* \date 19.10.2026
+* \version 2.5
+*
+******************************************************************************/
+
+#pragma once
+
+#include "FrameView.h"
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <zmq.hpp>
+
+namespace DataForwarding
+{
+	constexpr int FORWARD_START_PORT = 5770;						//!< Port of forwarding channel 0 (Data Forwarding MO)
+	constexpr int BACKWARD_START_PORT = 5870;						//!< Port of backwarding channel 0 (Data Backwarding MO)
+	constexpr int FORWARD_RECEIVE_HWM = 3;							//!< Default receive queue per channel, same as the send queue of the MO
+	constexpr std::size_t POLL_MESSAGES_PER_CHANNEL = 8;			//!< Messages taken from one channel per pass of Poll()
+
+	/**
+	 * \brief Default topic of AddChannel(), only matches the default stream "out/image0".
+	 *		Variants, profiles and bundles are published under their own prefixes ("variant/",
+	 *		"profile/<name>", "bundle/sync") and have to be subscribed to explicitly.
+	 */
+	constexpr const char* FORWARD_TOPIC_PREFIX = "out";
+
+	constexpr std::string_view BUNDLE_TOPIC_PREFIX = "bundle/";		//!< Topics of bundles, e.g. "bundle/sync"
+
+	/**
+	 * \brief The frames of one bundle, one per bundle input in the order of the inputs.
+	 *		The views are only valid during the call of the bundle handler.
+	 */
+	struct SBundleView
+	{
+		const CFrameView* const*	ppFrames{};
+		std::size_t					uiFrames{};
+
+		std::size_t size() const { return uiFrames; }
+		bool empty() const { return uiFrames == 0; }
+		const CFrameView& operator[](std::size_t uiIndex) const { return *ppFrames[uiIndex]; }
+		const CFrameView* const* begin() const { return ppFrames; }
+		const CFrameView* const* end() const { return ppFrames + uiFrames; }
+	};
+
+	/**
+	 * \brief Connects to any number of forwarding / backwarding channels and services them from one poll loop.
+	 *		Received frames are handed out as CFrameView referencing the receive buffers of the channel,
+	 *		nothing is copied on the way from the socket to the handler. A bundle is handed to the bundle
+	 *		handler as a whole; without bundle handler its frames are dispatched one after the other to the
+	 *		frame handler, see CFrameView::BundleIndex().
+	 *		The class is not thread-safe, all calls have to be made from the same thread.
+	 */
+	class CClient
+	{
+	public:
+		/**
+		 * \brief Frame callback. The view is only valid during the call.
+		 * \param[in] uiChannel Index returned by AddChannel().
+		 * \param[in] rFrame The received frame.
+		 */
+		using FrameHandler = std::function<void(std::size_t uiChannel, const CFrameView& rFrame)>;
+
+		/**
+		 * \brief Bundle callback. The views are only valid during the call.
+		 * \param[in] uiChannel Index returned by AddChannel().
+		 * \param[in] rsBundle All frames of the received bundle.
+		 */
+		using BundleHandler = std::function<void(std::size_t uiChannel, const SBundleView& rsBundle)>;
+
+		/**
+		 * \param[in] ssHost Host name or ip address of the AVETO Visualization host.
+		 * \param[in] iForwardStartPort Port of forwarding channel 0.
+		 * \param[in] iBackwardStartPort Port of backwarding channel 0.
+		 */
+		explicit CClient(std::string ssHost, int iForwardStartPort = FORWARD_START_PORT,
+			int iBackwardStartPort = BACKWARD_START_PORT) :
+			m_ssHost(std::move(ssHost)),
+			m_iForwardStartPort(iForwardStartPort),
+			m_iBackwardStartPort(iBackwardStartPort)
+		{
+		}
+
+		CClient(const CClient&) = delete;
+		CClient& operator=(const CClient&) = delete;
+
+		/**
+		 * \brief Sets the receive queue (ZMQ_RCVHWM, messages) of the channels added afterwards.
+		 *		A short queue drops old frames instead of handing out stale ones when the handler
+		 *		does not keep up; 0 queues without limit.
+		 */
+		void SetReceiveHwm(int iHwm) { m_iReceiveHwm = iHwm; }
+
+		/**
+		 * \brief Adds a channel pair.
+		 * \param[in] iForwardChannel Forwarding channel to subscribe to (-1: none).
+		 * \param[in] iBackwardChannel Backwarding channel to push results to (-1: none).
+		 * \param[in] ssTopic Topic prefix to subscribe to, e.g. "variant/image0/half" or "bundle/sync".
+		 *		Add the channel once per topic to receive several of them.
+		 * \return Index of the new channel, used by the frame handler and Send().
+		 */
+		std::size_t AddChannel(int iForwardChannel, int iBackwardChannel = -1, const std::string& ssTopic = FORWARD_TOPIC_PREFIX)
+		{
+			auto ptrChannel = std::make_unique<SChannel>();
+
+			if (iForwardChannel >= 0)
+			{
+				ptrChannel->sockSub = zmq::socket_t(m_ZmqCtx, zmq::socket_type::sub);
+				ptrChannel->sockSub.set(zmq::sockopt::linger, 0);
+				ptrChannel->sockSub.set(zmq::sockopt::rcvhwm, m_iReceiveHwm);
+				ptrChannel->sockSub.set(zmq::sockopt::subscribe, ssTopic);
+				ptrChannel->sockSub.connect(Endpoint(m_iForwardStartPort + iForwardChannel));
+			}
+
+			if (iBackwardChannel >= 0)
+			{
+				ptrChannel->sockPush = zmq::socket_t(m_ZmqCtx, zmq::socket_type::push);
+				ptrChannel->sockPush.set(zmq::sockopt::linger, 0);
+				ptrChannel->sockPush.connect(Endpoint(m_iBackwardStartPort + iBackwardChannel));
+			}
+
+			m_vecChannels.push_back(std::move(ptrChannel));
+			m_bPollItemsDirty = true;
+
+			return m_vecChannels.size() - 1;
+		}
+
+		std::size_t GetChannelCount() const { return m_vecChannels.size(); }
+
+		/**
+		 * \brief Waits for frames on all forwarding channels and dispatches the received frames.
+		 *		At most POLL_MESSAGES_PER_CHANNEL messages are taken from a channel per call, so a fast
+		 *		channel can not starve the others; call Poll() in a loop.
+		 * \param[in] timeout Maximum wait time if no frame is pending.
+		 * \param[in] fnHandler Called once per received frame.
+		 * \param[in] fnBundleHandler Called once per received bundle (optional). Bundles with an invalid
+		 *		frame are dropped as a whole.
+		 * \return Number of dispatched frames.
+		 */
+		std::size_t Poll(std::chrono::milliseconds timeout, const FrameHandler& fnHandler, const BundleHandler& fnBundleHandler = nullptr)
+		{
+			if (m_bPollItemsDirty)
+				RebuildPollItems();
+
+			if (m_vecPollItems.empty())
+				return 0;
+
+			if (zmq::poll(m_vecPollItems, timeout) <= 0)
+				return 0;
+
+			std::size_t uiFrames = 0;
+			for (std::size_t i = 0; i < m_vecPollItems.size(); i++)
+			{
+				if (!(m_vecPollItems[i].revents & ZMQ_POLLIN))
+					continue;
+
+				const std::size_t uiChannel = m_vecPollIndex[i];
+				auto& rChannel = *m_vecChannels[uiChannel];
+
+				// take a limited number of messages, the remaining ones are handled by the next call
+				for (std::size_t uiMessages = 0; uiMessages < POLL_MESSAGES_PER_CHANNEL && Receive(rChannel); uiMessages++)
+				{
+					const std::string_view svTopic(static_cast<const char*>(rChannel.msgTopic.data()), rChannel.msgTopic.size());
+					const bool bBundle = fnBundleHandler && svTopic.substr(0, BUNDLE_TOPIC_PREFIX.size()) == BUNDLE_TOPIC_PREFIX;
+
+					// every part gets its own view, so all frames of a bundle are valid at the same time
+					rChannel.vecValid.clear();
+					for (std::size_t uiPart = 0; uiPart < rChannel.uiBodies; uiPart++)
+					{
+						if (rChannel.vecFrames.size() <= uiPart)
+							rChannel.vecFrames.push_back(std::make_unique<CFrameView>());
+
+						CFrameView& rFrame = *rChannel.vecFrames[uiPart];
+						if (!rFrame.Parse(rChannel.msgTopic, rChannel.vecBodies[uiPart], uiPart, rChannel.uiBodies))
+						{
+							m_uiInvalidFrames++;
+							continue;
+						}
+
+						rChannel.vecValid.push_back(&rFrame);
+					}
+
+					if (!bBundle)
+					{
+						for (const CFrameView* pFrame : rChannel.vecValid)
+						{
+							fnHandler(uiChannel, *pFrame);
+						}
+						uiFrames += rChannel.vecValid.size();
+						continue;
+					}
+
+					if (rChannel.vecValid.size() != rChannel.uiBodies)
+						continue;
+
+					fnBundleHandler(uiChannel, SBundleView{ rChannel.vecValid.data(), rChannel.vecValid.size() });
+					uiFrames += rChannel.vecValid.size();
+				}
+			}
+
+			return uiFrames;
+		}
+
+		/**
+		 * \brief Sends a backwarding message (e.g. from CBackwardBuilder::Finish()) on the given channel.
+		 * \return Returns false if the channel has no backwarding socket or the message could not be queued.
+		 */
+		bool Send(std::size_t uiChannel, zmq::message_t&& msg)
+		{
+			if (uiChannel >= m_vecChannels.size())
+				return false;
+
+			auto& rSock = m_vecChannels[uiChannel]->sockPush;
+			if (!rSock)
+				return false;
+
+			return rSock.send(msg, zmq::send_flags::dontwait).has_value();
+		}
+
+		/**
+		 * \brief Number of received messages which were no valid forwarding messages.
+		 */
+		uint64_t GetInvalidCount() const { return m_uiInvalidFrames; }
+
+	private:
+		struct SChannel
+		{
+			zmq::socket_t					sockSub;			//!< Forwarding (subscriber) socket
+			zmq::socket_t					sockPush;			//!< Backwarding (push) socket
+			zmq::message_t					msgTopic;			//!< Receive buffer topic part, reused per frame
+			std::vector<zmq::message_t>		vecBodies;			//!< Receive buffers of the body parts (several for bundles), reused
+			std::size_t						uiBodies{};			//!< Body parts of the current message
+			std::vector<std::unique_ptr<CFrameView>>	vecFrames;	//!< Views on msgTopic and vecBodies, one per body part, reused
+			std::vector<const CFrameView*>	vecValid;			//!< Successfully parsed views of the current message
+		};
+
+		std::string Endpoint(int iPort) const
+		{
+			return "tcp://" + m_ssHost + ":" + std::to_string(iPort);
+		}
+
+		void RebuildPollItems()
+		{
+			m_vecPollItems.clear();
+			m_vecPollIndex.clear();
+
+			for (std::size_t i = 0; i < m_vecChannels.size(); i++)
+			{
+				if (!m_vecChannels[i]->sockSub)
+					continue;
+
+				m_vecPollItems.push_back({ m_vecChannels[i]->sockSub.handle(), 0, ZMQ_POLLIN, 0 });
+				m_vecPollIndex.push_back(i);
+			}
+
+			m_bPollItemsDirty = false;
+		}
+
+		bool Receive(SChannel& rChannel)
+		{
+			while (true)
+			{
+				if (!rChannel.sockSub.recv(rChannel.msgTopic, zmq::recv_flags::dontwait))
+					return false;
+
+				if (!rChannel.msgTopic.more())
+				{
+					m_uiInvalidFrames++;
+					continue;
+				}
+
+				// the remaining parts of a multipart message are always available at once
+				rChannel.uiBodies = 0;
+				do
+				{
+					if (rChannel.vecBodies.size() <= rChannel.uiBodies)
+						rChannel.vecBodies.emplace_back();
+
+					rChannel.sockSub.recv(rChannel.vecBodies[rChannel.uiBodies++], zmq::recv_flags::none);
+				} while (rChannel.vecBodies[rChannel.uiBodies - 1].more());
+
+				return true;
+			}
+		}
+
+		zmq::context_t									m_ZmqCtx;					//!< ZeroMQ context
+		std::string										m_ssHost;
+		int												m_iForwardStartPort;
+		int												m_iBackwardStartPort;
+		std::vector<std::unique_ptr<SChannel>>			m_vecChannels;
+		std::vector<zmq::pollitem_t>					m_vecPollItems;
+		std::vector<std::size_t>						m_vecPollIndex;				//!< Poll item -> channel index
+		bool											m_bPollItemsDirty{};
+		int												m_iReceiveHwm{ FORWARD_RECEIVE_HWM };
+		uint64_t										m_uiInvalidFrames{};
+	};
+}
@@ -0,0 +1,333 @@
+/******************************************************************************/
+/*! \file
+*
+* \verbatim
+******************************************************************************
+*                                                                            *
+*    Copyright (c) 2015-2026, b-plus technologies GmbH.                      *
+*                                                                            *
+*    All rights are reserved by b-plus technologies GmbH.                    *
+*    The Customer is entitled to modify this software under his              *
+*    own license terms.                                                      *
+*                                                                            *
+*    You may use this code according to the license terms of b-plus.         *
+*    Please contact b-plus at services@b-plus.com to get the actual          *
+*    terms and conditions.                                                   *
+*                                                                            *
+******************************************************************************
+\endverbatim
+*
+* \brief Data Forwarding Client - typed view on a received forwarding message
+* \author Christopher Maneth
+* \copyright (C)2015-2026 b-plus technologies GmbH
+* \date 19.10.2026
+* \version 2.5
+*
+******************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <msgpack.hpp>
+#include <zmq.hpp>
+
+namespace DataForwarding
+{
+	constexpr std::string_view CHUNK_TYPE_SUFFIX = "_chunk";		//!< Type suffix of chunked messages, e.g. "image_chunk"
+	constexpr uint64_t MAX_REASSEMBLY_SIZE = uint64_t(1) << 30;	//!< Largest payload the assemblers allocate for (1 GiB)
+
+	/**
+	 * \brief Position of a chunk inside the payload of a chunked message.
+	 */
+	struct SChunkInfo
+	{
+		uint64_t		uiOffset = 0;									//!< Byte offset of the chunk inside the payload
+		uint64_t		uiTotalSize = 0;								//!< Size of the complete payload
+		uint64_t		uiIndex = 0;									//!< Index of the chunk
+		uint64_t		uiCount = 0;									//!< Number of chunks of the payload
+	};
+
+	namespace detail
+	{
+		/**
+		 * \brief Checks a piece (chunk or multicast fragment) of a payload which was split into pieces of
+		 *		equal size: every piece but the last one has the full size and starts at index * size, the
+		 *		last one ends the payload. Distinct indices of consistent pieces cover the payload without gaps.
+		 * \param[out] ruiPieceSize Size of all but the last piece, equal for all pieces of the payload.
+		 * \return Returns false if the piece is not consistent with its header.
+		 */
+		inline bool CheckPiece(uint64_t uiOffset, uint64_t uiSize, uint64_t uiTotalSize, uint64_t uiIndex, uint64_t uiCount,
+			uint64_t& ruiPieceSize)
+		{
+			if (uiCount == 0 || uiIndex >= uiCount || uiCount > (uiTotalSize > 0 ? uiTotalSize : 1) ||
+				uiSize > uiTotalSize || uiOffset > uiTotalSize - uiSize)
+			{
+				return false;
+			}
+
+			if (uiCount == 1)
+			{
+				ruiPieceSize = uiTotalSize;
+				return uiOffset == 0 && uiSize == uiTotalSize;
+			}
+
+			if (uiIndex + 1 < uiCount)
+			{
+				if (uiSize == 0 || uiOffset % uiSize != 0 || uiOffset / uiSize != uiIndex)
+					return false;
+
+				ruiPieceSize = uiSize;
+			}
+			else
+			{
+				if (uiOffset + uiSize != uiTotalSize || uiOffset % uiIndex != 0)
+					return false;
+
+				ruiPieceSize = uiOffset / uiIndex;
+				if (uiSize == 0 || uiSize > ruiPieceSize)
+					return false;
+			}
+
+			// the piece size has to split the payload into exactly uiCount pieces
+			return (uiTotalSize - 1) / ruiPieceSize + 1 == uiCount;
+		}
+
+		/**
+		 * \brief Unpack reference function which lets every STR/BIN object point into the source buffer.
+		 */
+		inline bool ReferenceAll(msgpack::type::object_type, std::size_t, void*)
+		{
+			return true;
+		}
+
+		/**
+		 * \brief Sequential reader over a stream of msgpack objects (as written by the MOs).
+		 *		Strings and binaries are not copied, they reference the underlying buffer.
+		 */
+		class CMsgReader
+		{
+		public:
+			CMsgReader(msgpack::zone& rZone, const void* pData, std::size_t uiSize) :
+				m_rZone(rZone),
+				m_pData(static_cast<const char*>(pData)),
+				m_uiSize(uiSize),
+				m_uiOffset(0)
+			{
+			}
+
+			bool Next(msgpack::object& rObj)
+			{
+				if (m_uiOffset >= m_uiSize)
+					return false;
+
+				bool bReferenced = false;
+				rObj = msgpack::unpack(m_rZone, m_pData, m_uiSize, m_uiOffset, bReferenced, &ReferenceAll);
+				return true;
+			}
+
+			bool NextString(std::string_view& rsv)
+			{
+				msgpack::object obj;
+				if (!Next(obj) || obj.type != msgpack::type::STR)
+					return false;
+
+				rsv = std::string_view(obj.via.str.ptr, obj.via.str.size);
+				return true;
+			}
+
+			bool NextUInt(uint64_t& ruiValue)
+			{
+				msgpack::object obj;
+				if (!Next(obj) || obj.type != msgpack::type::POSITIVE_INTEGER)
+					return false;
+
+				ruiValue = obj.via.u64;
+				return true;
+			}
+
+			bool NextFormatSize(std::array<int, 3>& raFormatSize)
+			{
+				msgpack::object obj;
+				if (!Next(obj) || obj.type != msgpack::type::ARRAY || obj.via.array.size != 3)
+					return false;
+
+				for (uint32_t i = 0; i < 3; i++)
+				{
+					raFormatSize[i] = obj.via.array.ptr[i].as<int>();
+				}
+				return true;
+			}
+
+			bool NextChunkInfo(SChunkInfo& rsChunk)
+			{
+				msgpack::object obj;
+				if (!Next(obj) || obj.type != msgpack::type::ARRAY || obj.via.array.size != 4)
+					return false;
+
+				rsChunk.uiOffset = obj.via.array.ptr[0].as<uint64_t>();
+				rsChunk.uiTotalSize = obj.via.array.ptr[1].as<uint64_t>();
+				rsChunk.uiIndex = obj.via.array.ptr[2].as<uint64_t>();
+				rsChunk.uiCount = obj.via.array.ptr[3].as<uint64_t>();
+				return true;
+			}
+
+			bool NextBin(const uint8_t*& rpData, std::size_t& ruiSize)
+			{
+				msgpack::object obj;
+				if (!Next(obj) || obj.type != msgpack::type::BIN)
+					return false;
+
+				rpData = reinterpret_cast<const uint8_t*>(obj.via.bin.ptr);
+				ruiSize = obj.via.bin.size;
+				return true;
+			}
+
+		private:
+			msgpack::zone&		m_rZone;
+			const char*			m_pData;
+			std::size_t			m_uiSize;
+			std::size_t			m_uiOffset;
+		};
+	}
+
+	/**
+	 * \brief Typed, zero-copy view on a forwarding message (see README "Message format").
+	 *		For chunked messages Type() returns the type without the chunk suffix, Payload() the data
+	 *		of this chunk and Chunk() its position inside the complete payload (see CChunkAssembler).
+	 *		Bundles (topic "bundle/sync") carry one message per input, BundleIndex() is the position of
+	 *		the frame inside its bundle and Source() the name of the input.
+	 *		All accessors point into the zmq::message_t objects passed to Parse(), so the view is
+	 *		only valid as long as these messages are alive and unmodified.
+	 */
+	class CFrameView
+	{
+	public:
+		CFrameView() = default;
+
+		CFrameView(const CFrameView&) = delete;
+		CFrameView& operator=(const CFrameView&) = delete;
+
+		/**
+		 * \brief Parses the topic and body parts of a forwarding message.
+		 * \param[in] uiBundleIndex Index of the body part (bundles consist of several body parts).
+		 * \param[in] uiBundleSize Number of body parts of the message.
+		 * \return Returns false if the body is no valid forwarding message.
+		 */
+		bool Parse(const zmq::message_t& msgTopic, const zmq::message_t& msgBody, std::size_t uiBundleIndex = 0, std::size_t uiBundleSize = 1)
+		{
+			return Parse(std::string_view(static_cast<const char*>(msgTopic.data()), msgTopic.size()),
+				msgBody.data(), msgBody.size(), uiBundleIndex, uiBundleSize);
+		}
+
+		/**
+		 * \brief Parses a forwarding message body from a buffer (e.g. reassembled multicast fragments).
+		 *		The view references svTopic and pBody.
+		 */
+		bool Parse(std::string_view svTopic, const void* pBody, std::size_t uiBodySize, std::size_t uiBundleIndex = 0, std::size_t uiBundleSize = 1)
+		{
+			Reset();
+			m_zone.clear();
+			m_uiBundleIndex = uiBundleIndex;
+			m_uiBundleSize = uiBundleSize;
+
+			m_svTopic = svTopic;
+
+			try
+			{
+				detail::CMsgReader reader(m_zone, pBody, uiBodySize);
+				if (!reader.NextString(m_svSource) ||
+					!reader.NextUInt(m_uiTimestamp) ||
+					!reader.NextString(m_svType) ||
+					!reader.NextString(m_svFormat) ||
+					!reader.NextFormatSize(m_aFormatSize))
+				{
+					Reset();
+					return false;
+				}
+
+				if (m_svType.size() > CHUNK_TYPE_SUFFIX.size() &&
+					m_svType.substr(m_svType.size() - CHUNK_TYPE_SUFFIX.size()) == CHUNK_TYPE_SUFFIX)
+				{
+					m_svType.remove_suffix(CHUNK_TYPE_SUFFIX.size());
+					m_bChunk = reader.NextChunkInfo(m_sChunk);
+					if (!m_bChunk)
+					{
+						Reset();
+						return false;
+					}
+				}
+
+				if (!reader.NextBin(m_pPayload, m_uiPayloadSize))
+				{
+					Reset();
+					return false;
+				}
+			}
+			catch (std::exception&)
+			{
+				Reset();
+				return false;
+			}
+
+			m_bValid = true;
+			return true;
+		}
+
+		bool IsValid() const { return m_bValid; }
+		bool IsImage() const { return m_svType == "image"; }			//!< Also true for the chunks of an image, see IsChunk()
+		bool IsRaw() const { return m_svType == "raw"; }
+		bool IsMetadataOnly() const { return m_svType == "metadata_only"; }
+		bool IsChunk() const { return m_bChunk; }
+		bool IsBundlePart() const { return m_uiBundleSize > 1; }
+
+		std::string_view Topic() const { return m_svTopic; }
+		std::string_view Source() const { return m_svSource; }
+		uint64_t Timestamp() const { return m_uiTimestamp; }
+		std::string_view Type() const { return m_svType; }
+		std::string_view Format() const { return m_svFormat; }
+		const std::array<int, 3>& FormatSize() const { return m_aFormatSize; }
+		int Width() const { return m_aFormatSize[0]; }
+		int Height() const { return m_aFormatSize[1]; }
+		int BitsPerPixel() const { return m_aFormatSize[2]; }
+		const uint8_t* Payload() const { return m_pPayload; }
+		std::size_t PayloadSize() const { return m_uiPayloadSize; }
+		const SChunkInfo& Chunk() const { return m_sChunk; }
+		std::size_t BundleIndex() const { return m_uiBundleIndex; }
+		std::size_t BundleSize() const { return m_uiBundleSize; }
+
+	private:
+		void Reset()
+		{
+			m_bValid = false;
+			m_svTopic = {};
+			m_svSource = {};
+			m_uiTimestamp = 0;
+			m_svType = {};
+			m_svFormat = {};
+			m_aFormatSize = { { 0, 0, 0 } };
+			m_pPayload = nullptr;
+			m_uiPayloadSize = 0;
+			m_bChunk = false;
+			m_sChunk = SChunkInfo();
+			m_uiBundleIndex = 0;
+			m_uiBundleSize = 1;
+		}
+
+		msgpack::zone				m_zone;							//!< Reused for the (small) array objects of each message
+		bool						m_bValid{};
+		std::string_view			m_svTopic;
+		std::string_view			m_svSource;
+		uint64_t					m_uiTimestamp{};
+		std::string_view			m_svType;
+		std::string_view			m_svFormat;
+		std::array<int, 3>			m_aFormatSize{ { 0, 0, 0 } };
+		const uint8_t*				m_pPayload{};
+		std::size_t					m_uiPayloadSize{};
+		bool						m_bChunk{};
+		SChunkInfo					m_sChunk;
+		std::size_t					m_uiBundleIndex{};
+		std::size_t					m_uiBundleSize{ 1 };
+	};
+}
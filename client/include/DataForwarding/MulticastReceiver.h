@@ -0,0 +1,320 @@
+/******************************************************************************/
+/*! \file
+*
+* \verbatim
+******************************************************************************
+*                                                                            *
+*    Copyright (c) 2015-2026, b-plus technologies GmbH.                      *
+*                                                                            *
+*    All rights are reserved by b-plus technologies GmbH.                    *
+*    The Customer is entitled to modify this software under his              *
+*    own license terms.                                                      *
+*                                                                            *
+*    You may use this code according to the license terms of b-plus.         *
+*    Please contact b-plus at services@b-plus.com to get the actual          *
+*    terms and conditions.                                                   *
+*                                                                            *
+******************************************************************************
+\endverbatim
+*
+* \brief Data Forwarding Client - UDP multicast (RADIO/DISH) receiver
+* \author Christopher Maneth
+* \copyright (C)2015-2026 b-plus technologies GmbH
+* \date 19.10.2026
+* \version 2.5
+*
+******************************************************************************/
+
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+#include <zmq.hpp>
+
+#include "FrameView.h"
+
+namespace DataForwarding
+{
+	constexpr int MULTICAST_START_PORT = 5970;						//!< UDP port of forwarding channel 0
+	constexpr const char* MULTICAST_ADDRESS = "239.0.0.1";			//!< Multicast group address of the forwarding channels
+	constexpr std::size_t MULTICAST_DATAGRAM_SIZE = 8192;			//!< libzmq UDP datagram limit, including the group
+	constexpr std::size_t FRAGMENT_HEADER_SIZE = 16;
+	constexpr int32_t MULTICAST_RESTART_WINDOW = 64;				//!< Late messages / fragments in a row taken as a sender restart
+
+	/**
+	 * \brief Header of a multicast fragment, stored little endian in front of the fragment data.
+	 */
+	struct SFragmentHeader
+	{
+		uint32_t		uiSequence = 0;									//!< Message sequence of the group
+		uint16_t		uiIndex = 0;									//!< Index of the fragment
+		uint16_t		uiCount = 0;									//!< Number of fragments of the message
+		uint32_t		uiTotalSize = 0;								//!< Size of the complete message body
+		uint32_t		uiOffset = 0;									//!< Offset of the fragment data in the message body
+
+		void Write(uint8_t* pDst) const
+		{
+			WriteLE(pDst, uiSequence, 4);
+			WriteLE(pDst + 4, uiIndex, 2);
+			WriteLE(pDst + 6, uiCount, 2);
+			WriteLE(pDst + 8, uiTotalSize, 4);
+			WriteLE(pDst + 12, uiOffset, 4);
+		}
+
+		bool Read(const uint8_t* pSrc, std::size_t uiSize)
+		{
+			if (uiSize < FRAGMENT_HEADER_SIZE)
+				return false;
+
+			uiSequence = static_cast<uint32_t>(ReadLE(pSrc, 4));
+			uiIndex = static_cast<uint16_t>(ReadLE(pSrc + 4, 2));
+			uiCount = static_cast<uint16_t>(ReadLE(pSrc + 6, 2));
+			uiTotalSize = static_cast<uint32_t>(ReadLE(pSrc + 8, 4));
+			uiOffset = static_cast<uint32_t>(ReadLE(pSrc + 12, 4));
+			return true;
+		}
+
+	private:
+		static void WriteLE(uint8_t* pDst, uint32_t uiValue, std::size_t uiBytes)
+		{
+			for (std::size_t i = 0; i < uiBytes; i++)
+			{
+				pDst[i] = static_cast<uint8_t>(uiValue >> (8 * i));
+			}
+		}
+
+		static uint32_t ReadLE(const uint8_t* pSrc, std::size_t uiBytes)
+		{
+			uint32_t uiValue = 0;
+			for (std::size_t i = 0; i < uiBytes; i++)
+			{
+				uiValue |= static_cast<uint32_t>(pSrc[i]) << (8 * i);
+			}
+			return uiValue;
+		}
+	};
+
+	/**
+	 * \brief Reassembles the fragments of the messages of one multicast group.
+	 *		Fragments may arrive in any order. A fragment of a newer message gives up the current one,
+	 *		so a lost datagram costs exactly one message. Lost messages are counted, including the
+	 *		messages of which not a single fragment arrived (sequence gaps). Fragments which do not match
+	 *		their header or the other fragments of the message are counted as invalid or ignored.
+	 *		The sequence starts at 0 again when the MO restarts: a fragment more than
+	 *		MULTICAST_RESTART_WINDOW messages behind, or as many late fragments in a row, restart the
+	 *		reassembly at the sequence of the sender.
+	 */
+	class CFragmentAssembler
+	{
+	public:
+		/**
+		 * \brief Adds a datagram (fragment header + fragment data).
+		 * \return Returns true if the datagram completed a message, see Data() and Size().
+		 */
+		bool Add(const uint8_t* pDatagram, std::size_t uiSize)
+		{
+			SFragmentHeader sHeader;
+			uint64_t uiFragmentSize = 0;
+			if (!sHeader.Read(pDatagram, uiSize) || sHeader.uiTotalSize > MAX_REASSEMBLY_SIZE ||
+				!detail::CheckPiece(sHeader.uiOffset, uiSize - FRAGMENT_HEADER_SIZE, sHeader.uiTotalSize, sHeader.uiIndex, sHeader.uiCount, uiFragmentSize))
+			{
+				m_uiInvalid++;
+				return false;
+			}
+
+			if (m_bStarted)
+			{
+				const int32_t iDelta = static_cast<int32_t>(sHeader.uiSequence - m_uiSequence);
+				if (iDelta < 0 && iDelta >= -MULTICAST_RESTART_WINDOW && ++m_iLateInRow < MULTICAST_RESTART_WINDOW)
+				{
+					m_uiLate++;													// the message was given up already
+					return false;
+				}
+
+				m_iLateInRow = 0;
+				if (iDelta < 0)
+				{
+					m_uiRestarts++;												// the sender restarted its sequence
+					Start(sHeader, uiFragmentSize);
+				}
+				else if (iDelta > 0)
+				{
+					if (!m_bComplete)
+						m_uiLost++;
+					m_uiLost += static_cast<uint64_t>(iDelta) - 1;
+					Start(sHeader, uiFragmentSize);
+				}
+				else if (m_bComplete || sHeader.uiCount != m_vecReceived.size() || sHeader.uiTotalSize != m_vecBuffer.size() ||
+					uiFragmentSize != m_uiFragmentSize)
+				{
+					return false;												// duplicate or inconsistent fragment
+				}
+			}
+			else
+			{
+				Start(sHeader, uiFragmentSize);
+			}
+
+			if (m_vecReceived[sHeader.uiIndex])
+				return false;
+
+			const std::size_t uiDataSize = uiSize - FRAGMENT_HEADER_SIZE;
+			if (uiDataSize > 0)
+				memcpy(m_vecBuffer.data() + sHeader.uiOffset, pDatagram + FRAGMENT_HEADER_SIZE, uiDataSize);
+
+			m_vecReceived[sHeader.uiIndex] = true;
+			m_uiFragments++;
+			if (++m_uiReceived < m_vecReceived.size())
+				return false;
+
+			m_bComplete = true;
+			m_uiComplete++;
+			return true;
+		}
+
+		const uint8_t* Data() const { return m_vecBuffer.data(); }
+		std::size_t Size() const { return m_vecBuffer.size(); }
+
+		uint64_t GetCompleteCount() const { return m_uiComplete; }			//!< Reassembled messages
+		uint64_t GetLostCount() const { return m_uiLost; }					//!< Messages given up or never seen
+		uint64_t GetLateCount() const { return m_uiLate; }					//!< Fragments of messages given up already
+		uint64_t GetFragmentCount() const { return m_uiFragments; }			//!< Accepted fragments
+		uint64_t GetInvalidCount() const { return m_uiInvalid; }			//!< Datagrams with an invalid header
+		uint64_t GetRestartCount() const { return m_uiRestarts; }			//!< Detected sender restarts
+
+	private:
+		void Start(const SFragmentHeader& rsHeader, uint64_t uiFragmentSize)
+		{
+			m_bStarted = true;
+			m_bComplete = false;
+			m_uiSequence = rsHeader.uiSequence;
+			m_uiFragmentSize = uiFragmentSize;
+			m_vecBuffer.resize(rsHeader.uiTotalSize);
+			m_vecReceived.assign(rsHeader.uiCount, false);
+			m_uiReceived = 0;
+		}
+
+		std::vector<uint8_t>		m_vecBuffer;						//!< Message being reassembled, reused
+		std::vector<bool>			m_vecReceived;						//!< Received fragments of the current message
+		std::size_t					m_uiReceived{};
+		uint32_t					m_uiSequence{};
+		uint64_t					m_uiFragmentSize{};					//!< Size of all but the last fragment
+		int32_t						m_iLateInRow{};
+		bool						m_bStarted{};
+		bool						m_bComplete{};
+		uint64_t					m_uiComplete{};
+		uint64_t					m_uiLost{};
+		uint64_t					m_uiLate{};
+		uint64_t					m_uiFragments{};
+		uint64_t					m_uiInvalid{};
+		uint64_t					m_uiRestarts{};
+	};
+
+#if defined(ZMQ_BUILD_DRAFT_API)
+	/**
+	 * \brief Receives the forwarding messages a Data Forwarding MO sends via UDP multicast ("Multicast
+	 *		Topics" property). Every joined group is a topic, e.g. "out/image0"; groups are matched
+	 *		exactly. Requires libzmq / cppzmq built with the draft API (ZMQ_BUILD_DRAFT_API).
+	 *		The class is not thread-safe, all calls have to be made from the same thread.
+	 *
+	 * Usage:
+	 *		CMulticastReceiver receiver(0);
+	 *		receiver.Join("out/image0");
+	 *		receiver.Poll(100ms, [](const CFrameView& rFrame) { ... });
+	 */
+	class CMulticastReceiver
+	{
+	public:
+		using FrameHandler = std::function<void(const CFrameView& rFrame)>;
+
+		/**
+		 * \param[in] iChannel Forwarding channel.
+		 * \param[in] ssInterface Address of the network interface to receive on (empty: any).
+		 * \param[in] iStartPort UDP port of channel 0.
+		 * \param[in] iReceiveBuffer Kernel receive buffer in bytes, should hold at least one frame.
+		 */
+		explicit CMulticastReceiver(int iChannel = 0, const std::string& ssInterface = "127.0.0.1",
+			int iStartPort = MULTICAST_START_PORT, int iReceiveBuffer = 32 * 1024 * 1024) :
+			m_sockDish(m_ZmqCtx, zmq::socket_type::dish)
+		{
+			std::string ssEndpoint = "udp://";
+			if (!ssInterface.empty())
+				ssEndpoint += ssInterface + ";";
+			ssEndpoint += std::string(MULTICAST_ADDRESS) + ":" + std::to_string(iStartPort + iChannel);
+
+			m_sockDish.set(zmq::sockopt::linger, 0);
+			m_sockDish.set(zmq::sockopt::rcvhwm, 0);						// fragments are only dropped by the kernel
+			m_sockDish.set(zmq::sockopt::rcvbuf, iReceiveBuffer);
+			m_sockDish.bind(ssEndpoint);
+		}
+
+		CMulticastReceiver(const CMulticastReceiver&) = delete;
+		CMulticastReceiver& operator=(const CMulticastReceiver&) = delete;
+
+		void Join(const std::string& ssGroup)
+		{
+			m_sockDish.join(ssGroup.c_str());
+			m_mapGroups[ssGroup];
+		}
+
+		/**
+		 * \brief Waits for datagrams and dispatches every completed message.
+		 * \return Number of dispatched frames.
+		 */
+		std::size_t Poll(std::chrono::milliseconds timeout, const FrameHandler& fnHandler)
+		{
+			std::vector<zmq::pollitem_t> vecPollItems{ { m_sockDish.handle(), 0, ZMQ_POLLIN, 0 } };
+			if (zmq::poll(vecPollItems, timeout) <= 0)
+				return 0;
+
+			std::size_t uiFrames = 0;
+			while (m_sockDish.recv(m_msgDatagram, zmq::recv_flags::dontwait))
+			{
+				auto it = m_mapGroups.find(m_msgDatagram.group());
+				if (it == m_mapGroups.end())
+					continue;
+
+				CFragmentAssembler& rAssembler = it->second;
+				if (!rAssembler.Add(static_cast<const uint8_t*>(m_msgDatagram.data()), m_msgDatagram.size()))
+					continue;
+
+				if (!m_frame.Parse(it->first, rAssembler.Data(), rAssembler.Size()))
+				{
+					m_uiInvalidFrames++;
+					continue;
+				}
+
+				fnHandler(m_frame);
+				uiFrames++;
+			}
+
+			return uiFrames;
+		}
+
+		/**
+		 * \brief Reassembly state and loss accounting of a joined group.
+		 */
+		const CFragmentAssembler* GetGroup(const std::string& ssGroup) const
+		{
+			auto it = m_mapGroups.find(ssGroup);
+			return it != m_mapGroups.end() ? &it->second : nullptr;
+		}
+
+		uint64_t GetInvalidCount() const { return m_uiInvalidFrames; }
+
+	private:
+		zmq::context_t									m_ZmqCtx;
+		zmq::socket_t									m_sockDish;
+		zmq::message_t									m_msgDatagram;			//!< Receive buffer, reused
+		std::map<std::string, CFragmentAssembler>		m_mapGroups;			//!< Joined groups (topic -> reassembly)
+		CFrameView										m_frame;
+		uint64_t										m_uiInvalidFrames{};
+	};
+#endif
+}
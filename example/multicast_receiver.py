@@ -0,0 +1,92 @@
+import os
+import struct
+import zmq
+import msgpack
+from io import BytesIO
+
+
+# Receives the topics listed in the "Multicast Topics" property of the Data Forwarding MO.
+# Requires pyzmq / libzmq built with the draft API (RADIO/DISH sockets).
+
+MULTICAST_INTERFACE = os.getenv('MULTICAST_INTERFACE', '127.0.0.1')
+MULTICAST_ADDRESS = "239.0.0.1"
+RECV_CHANNEL = 0
+TOPIC = "out/image0"
+
+# fragment header: sequence, index, count, total size, offset (little endian)
+HEADER = struct.Struct("<IHHII")
+
+# a fragment this many messages behind, or as many late fragments in a row, mean the MO restarted its sequence
+RESTART_WINDOW = 64
+
+if not zmq.has("draft"):
+    raise SystemExit("pyzmq / libzmq without draft API, RADIO/DISH sockets are not available")
+
+context = zmq.Context()
+
+dish_socket = context.socket(zmq.DISH)
+dish_socket.setsockopt(zmq.RCVBUF, 32 * 1024 * 1024)
+dish_socket.setsockopt(zmq.RCVHWM, 0)
+dish_socket.bind(f"udp://{MULTICAST_INTERFACE};{MULTICAST_ADDRESS}:{5970+RECV_CHANNEL}")
+dish_socket.join(TOPIC)
+
+sequence = None
+buffer = None
+received = set()
+complete = False
+lost = 0
+late_in_row = 0
+
+while 1:
+    frame = dish_socket.recv(copy=False)
+    if len(frame.bytes) < HEADER.size:
+        continue
+
+    seq, index, count, total_size, offset = HEADER.unpack_from(frame.bytes)
+
+    if sequence is not None:
+        delta = (seq - sequence + 2**31) % 2**32 - 2**31
+        if -RESTART_WINDOW <= delta < 0:
+            late_in_row += 1
+            if late_in_row < RESTART_WINDOW:
+                # fragment of a message which was given up already
+                continue
+        late_in_row = 0
+        if delta > 0:
+            lost += delta - 1 + (0 if complete else 1)
+        if delta != 0:
+            # a newer message, or the MO restarted its sequence (delta < 0)
+            sequence = None
+
+    if sequence is None:
+        sequence = seq
+        buffer = bytearray(total_size)
+        received = set()
+        complete = False
+
+    if complete or index in received:
+        continue
+
+    data = frame.bytes[HEADER.size:]
+    buffer[offset:offset + len(data)] = data
+    received.add(index)
+    if len(received) < count:
+        continue
+
+    complete = True
+
+    unpacker = msgpack.Unpacker(BytesIO(buffer), raw=False)
+    msg_source = unpacker.__next__()
+    msg_timestamp = unpacker.__next__()
+    msg_type = unpacker.__next__()
+    msg_format = unpacker.__next__()
+    msg_format_size = unpacker.__next__()
+
+    print("TOPIC:", frame.group)
+    print("Source:", msg_source)
+    print("Timestamp:", msg_timestamp)
+    print("Type:", msg_type)
+    print("Format:", msg_format)
+    print("Format Size:", msg_format_size)
+    print("Lost messages:", lost)
+    print("")